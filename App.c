@@ -14,6 +14,7 @@
 #include "Led.h"
 #include "Dio.h"
 #include "Port.h"
+#include "Bench.h"
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -21,7 +22,15 @@ void Init_Task(void)
   /* Initialize Port Driver (it initializes everything) */  
   Port_Init(&PortConfigrations);
   /* Initialize Dio Driver */
-  //Dio_Init(&Dio_Configuration);
+  Dio_Init(&Dio_Configuration);
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+  /* Wake the button sampling on the edges of its pin */
+  Dio_EnableNotification(DioConf_SW1_CHANNEL_ID_INDEX);
+#endif
+#if (BENCH_RUN_AT_INIT == STD_ON)
+  /* Time the Dio paths once, the results are read from Bench_Report */
+  Bench_Run();
+#endif
 
   /* Initialize LED Driver */
   //LED_init();
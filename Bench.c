@@ -0,0 +1,277 @@
+/********************************************************************************
+ Module	        : Bench
+ File Name	: Bench.c
+ Author		: Yasser Waleed
+ Description    : Source file of the driver benchmarks
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Bench.h"
+#include "Gpio_Hw.h"
+
+#if (GPIO_HW_HOST_MODEL == STD_OFF)
+#include "tm4c123gh6pm_registers.h"
+#endif
+/********************************************************************************
+ LOCAL DATA TYPES
+*********************************************************************************/
+/* Channel write service under test */
+typedef void (*Bench_WriteChannelType)(Dio_ChannelType ChannelId, Dio_LevelType Level);
+/********************************************************************************
+ GLOBAL VARIABLES
+*********************************************************************************/
+Bench_ReportType Bench_Report;
+/********************************************************************************
+ LOCAL FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Function Name: Bench_Finish
+* Parameters (in): Count - Operations timed, Start - Time base value before the loop
+* Parameters (out): Result - Count, elapsed ticks and operations per second
+* Return value: None
+* Description: Closes a timed loop.
+************************************************************************************/
+static void Bench_Finish(Bench_ResultType * Result, uint32 Count, uint32 Start)
+{
+  Result->Count = Count;
+  Result->Ticks = Bench_GetTicks() - Start;
+  if(Result->Ticks != 0)
+  {
+    Result->PerSecond = (uint32)(((uint64)Count * BENCH_TICKS_PER_SECOND) / Result->Ticks);
+  }
+  else
+  {
+    Result->PerSecond = 0;
+  }
+}
+
+/************************************************************************************
+* Function Name: Bench_LegacyWriteChannel
+* Parameters (in): ChannelId - ID of DIO channel, Level - Value to be written
+* Return value: None
+* Description: Dio_WriteChannel as it was before Dio_Init resolved the channel
+*              accesses: channel and port block lookups on every call, then a
+*              read-modify-write of the all-pins GPIODATA word. Only the range
+*              check is kept, so the gap to Dio_WriteChannel is understated.
+************************************************************************************/
+static void Bench_LegacyWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+  if(ChannelId < DIO_CONFIGURED_CHANNLES)
+  {
+    const Dio_ConfigChannel * Channel = &Dio_Configuration.Channels[ChannelId];
+    volatile uint32 * Port_Ptr = &GPIO_HW_PORT(Channel->Port_Num)->DATA[GPIO_HW_DATA_ALL_PINS];
+
+    if(Level == STD_HIGH)
+    {
+      GPIO_HW_WRITE(*Port_Ptr, GPIO_HW_READ(*Port_Ptr) | (1UL << Channel->Ch_Num));
+    }
+    else if(Level == STD_LOW)
+    {
+      GPIO_HW_WRITE(*Port_Ptr, GPIO_HW_READ(*Port_Ptr) & ~(1UL << Channel->Ch_Num));
+    }
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+}
+
+/************************************************************************************
+* Function Name: Bench_TimeWrites
+* Parameters (in): Write - Channel write service under test
+* Parameters (out): Result - Timing of BENCH_ITERATIONS calls
+* Return value: None
+* Description: Alternates the level of BenchConf_CHANNEL_ID on every call.
+************************************************************************************/
+static void Bench_TimeWrites(Bench_WriteChannelType Write, Bench_ResultType * Result)
+{
+  uint32 Start = Bench_GetTicks();
+
+  for (uint32 index = 0; index < BENCH_ITERATIONS; index += 2U)
+  {
+    Write(BenchConf_CHANNEL_ID, STD_HIGH);
+    Write(BenchConf_CHANNEL_ID, STD_LOW);
+  }
+  Bench_Finish(Result, BENCH_ITERATIONS, Start);
+}
+
+/************************************************************************************
+* Function Name: Bench_TimeToggles
+* Parameters (in): Data - GPIODATA word whose address mask selects the pin alone
+*                  PinBit - Pin bit of the port
+* Parameters (out): Result - Timing of BENCH_ITERATIONS pin toggles
+* Return value: None
+* Description: Toggles the pin with back-to-back stores, one store and no read each.
+************************************************************************************/
+static void Bench_TimeToggles(volatile uint32 * Data, uint8 PinBit, Bench_ResultType * Result)
+{
+  uint32 Start = Bench_GetTicks();
+
+  for (uint32 index = 0; index < BENCH_ITERATIONS; index += 4U)
+  {
+    GPIO_HW_WRITE(*Data, PinBit);
+    GPIO_HW_WRITE(*Data, 0);
+    GPIO_HW_WRITE(*Data, PinBit);
+    GPIO_HW_WRITE(*Data, 0);
+  }
+  Bench_Finish(Result, BENCH_ITERATIONS, Start);
+}
+/********************************************************************************
+ FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Service Name: Bench_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Starts the DWT cycle counter, nothing to do on the host.
+************************************************************************************/
+void Bench_Init(void)
+{
+  #if (GPIO_HW_HOST_MODEL == STD_OFF)
+  CORE_DEMCR_REG |= BENCH_DEMCR_TRCENA;
+  DWT_CYCCNT_REG  = 0;
+  DWT_CTRL_REG   |= BENCH_DWT_CTRL_CYCCNTENA;
+  #endif
+}
+
+/************************************************************************************
+* Service Name: Bench_GetTicks
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the benchmark time base
+* Description: Reads DWT_CYCCNT on the target and clock() on the host.
+************************************************************************************/
+uint32 Bench_GetTicks(void)
+{
+  #if (GPIO_HW_HOST_MODEL == STD_ON)
+  return (uint32)clock();
+  #else
+  return DWT_CYCCNT_REG;
+  #endif
+}
+
+/************************************************************************************
+* Service Name: Bench_DioWriteChannel
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Legacy - Timing of the channel write path used before the
+*                            resolved channel table
+*                   Resolved - Timing of Dio_WriteChannel
+* Return value: None
+* Description: Writes BenchConf_CHANNEL_ID high and low BENCH_ITERATIONS times
+*              through both paths. Dio_Init must have been called.
+************************************************************************************/
+void Bench_DioWriteChannel(Bench_ResultType * Legacy, Bench_ResultType * Resolved)
+{
+  Bench_TimeWrites(Bench_LegacyWriteChannel, Legacy);
+  Bench_TimeWrites(Dio_WriteChannel, Resolved);
+}
+
+/************************************************************************************
+* Service Name: Bench_Toggle
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Apb - Timing of BENCH_ITERATIONS pin toggles through the APB aperture
+*                   Ahb - Timing of BENCH_ITERATIONS pin toggles through the AHB aperture
+* Return value: None
+* Description: Toggles the pin of BenchConf_CHANNEL_ID with back-to-back masked
+*              GPIODATA stores, once per aperture. The port's GPIOHBCTL bit is
+*              switched for each loop and restored afterwards, with the IRQs
+*              masked meanwhile. The pin runs at half the reported rate.
+*              Port_Init must have been called.
+************************************************************************************/
+void Bench_Toggle(Bench_ResultType * Apb, Bench_ResultType * Ahb)
+{
+  const Dio_ConfigChannel * Channel = &Dio_Configuration.Channels[BenchConf_CHANNEL_ID];
+  uint8 PinBit = (uint8)(1U << Channel->Ch_Num);
+  uint32 PortBit = 1UL << Channel->Port_Num;
+  uint32 Hbctl;
+  uint32 saved;
+
+  /* The port decodes in one aperture at a time: no ISR may reach it through the other one */
+  GPIO_HW_ENTER_CRITICAL(saved);
+  Hbctl = GPIO_HW_READ(GPIO_HW_HBCTL_REG);
+
+  GPIO_HW_WRITE(GPIO_HW_HBCTL_REG, Hbctl & ~PortBit);
+  Bench_TimeToggles(&GPIO_HW_PORT_APB(Channel->Port_Num)->DATA[PinBit], PinBit, Apb);
+
+  GPIO_HW_WRITE(GPIO_HW_HBCTL_REG, Hbctl | PortBit);
+  Bench_TimeToggles(&GPIO_HW_PORT_AHB(Channel->Port_Num)->DATA[PinBit], PinBit, Ahb);
+
+  /* Back to the aperture Port_Init selected, the one Dio resolved its accesses in */
+  GPIO_HW_WRITE(GPIO_HW_HBCTL_REG, Hbctl);
+  GPIO_HW_EXIT_CRITICAL(saved);
+}
+
+/************************************************************************************
+* Service Name: Bench_PbusWrite
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Result - Bytes written, ticks and bytes per second
+* Return value: Std_ReturnType - E_NOT_OK if Pbus_Init fails
+* Description: Initializes the parallel bus and writes BENCH_PBUS_BURSTS data
+*              bursts of BENCH_PBUS_BURST_LENGTH bytes. Port_Init and Dio_Init
+*              must have been called, the bus pins are driven.
+************************************************************************************/
+Std_ReturnType Bench_PbusWrite(Bench_ResultType * Result)
+{
+  static uint8 Burst[BENCH_PBUS_BURST_LENGTH];
+  uint32 Start;
+
+  if(Pbus_Init() != E_OK)
+  {
+    return E_NOT_OK;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+
+  for (uint32 index = 0; index < BENCH_PBUS_BURST_LENGTH; index++)
+  {
+    Burst[index] = (uint8)index;
+  }
+
+  Start = Bench_GetTicks();
+  for (uint32 burst = 0; burst < BENCH_PBUS_BURSTS; burst++)
+  {
+    Pbus_Write(PBUS_DATA, Burst, BENCH_PBUS_BURST_LENGTH);
+  }
+  Bench_Finish(Result, BENCH_PBUS_BURSTS * BENCH_PBUS_BURST_LENGTH, Start);
+  return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Bench_Run
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Runs every benchmark and stores the results in Bench_Report.
+************************************************************************************/
+void Bench_Run(void)
+{
+  Bench_Init();
+  Bench_DioWriteChannel(&Bench_Report.LegacyWrite, &Bench_Report.ResolvedWrite);
+  Bench_Toggle(&Bench_Report.ToggleApb, &Bench_Report.ToggleAhb);
+  (void)Bench_PbusWrite(&Bench_Report.PbusWrite);
+}
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
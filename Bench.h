@@ -0,0 +1,172 @@
+/**********************************************************************************
+ Module	     : Bench
+ File Name   : Bench.h
+ Author	     : Yasser Waleed
+ Description : Header file of the driver benchmarks. Times the Dio fast paths and
+               the parallel bus bursts on the DWT cycle counter of the target, or
+               on the process clock of the host model build.
+***********************************************************************************/
+#ifndef BENCH_H
+#define BENCH_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "Dio.h"
+#include "Pbus.h"
+#include "Bench_Cfg.h"
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#include <time.h>
+#endif
+/**********************************************************************************
+ VERSIONS CHECK
+***********************************************************************************/
+/* Module Version 1.0.0 */
+#define BENCH_SW_MAJOR_VERSION          (1U)
+#define BENCH_SW_MINOR_VERSION          (0U)
+#define BENCH_SW_PATCH_VERSION          (0U)
+
+/* AUTOSAR Version 4.0.3 */
+#define BENCH_AR_RELEASE_MAJOR_VERSION  (4U)
+#define BENCH_AR_RELEASE_MINOR_VERSION  (0U)
+#define BENCH_AR_RELEASE_PATCH_VERSION  (3U)
+
+/* AUTOSAR version checking between Bench_Cfg.h and Bench.h files */
+#if ((BENCH_CFG_AR_RELEASE_MAJOR_VERSION != BENCH_AR_RELEASE_MAJOR_VERSION)\
+ ||  (BENCH_CFG_AR_RELEASE_MINOR_VERSION != BENCH_AR_RELEASE_MINOR_VERSION)\
+ ||  (BENCH_CFG_AR_RELEASE_PATCH_VERSION != BENCH_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Bench_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Bench_Cfg.h and Bench.h files */
+#if ((BENCH_CFG_SW_MAJOR_VERSION != BENCH_SW_MAJOR_VERSION)\
+ ||  (BENCH_CFG_SW_MINOR_VERSION != BENCH_SW_MINOR_VERSION)\
+ ||  (BENCH_CFG_SW_PATCH_VERSION != BENCH_SW_PATCH_VERSION))
+  #error "The SW version of Bench_Cfg.h does not match the expected version"
+#endif
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+/* Rate of the benchmark time base: core cycles on the target, clock() ticks on the host */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define BENCH_TICKS_PER_SECOND          ((uint32)CLOCKS_PER_SEC)
+#else
+#define BENCH_TICKS_PER_SECOND          BENCH_CPU_CLOCK_HZ
+#endif
+
+/* DEMCR and DWT_CTRL bits enabling the cycle counter */
+#define BENCH_DEMCR_TRCENA              (0x01000000UL)
+#define BENCH_DWT_CTRL_CYCCNTENA        (0x00000001UL)
+/**********************************************************************************
+ DATA TYPES
+***********************************************************************************/
+/* One timed loop */
+typedef struct
+{
+  uint32 Count;                         /* Operations timed (calls, toggles or bytes) */
+  uint32 Ticks;                         /* Time base ticks they took */
+  uint32 PerSecond;                     /* Count scaled to one second */
+} Bench_ResultType;
+
+/* Results of Bench_Run, kept for the debugger watch window */
+typedef struct
+{
+  Bench_ResultType LegacyWrite;         /* Dio_WriteChannel before the resolved channel table */
+  Bench_ResultType ResolvedWrite;       /* Dio_WriteChannel through the resolved channel table */
+  Bench_ResultType ToggleApb;           /* Masked GPIODATA stores through the APB aperture */
+  Bench_ResultType ToggleAhb;           /* Masked GPIODATA stores through the AHB aperture */
+  Bench_ResultType PbusWrite;           /* Bytes of the Pbus_Write bursts */
+} Bench_ReportType;
+/**********************************************************************************
+ EXTERNAL VARIABLES
+***********************************************************************************/
+extern Bench_ReportType Bench_Report;
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+/*******************************************************************************
+* Service Name: Bench_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Starts the DWT cycle counter, nothing to do on the host.
+********************************************************************************/
+void Bench_Init(void);
+
+/*******************************************************************************
+* Service Name: Bench_GetTicks
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the benchmark time base
+* Description: Reads DWT_CYCCNT on the target and clock() on the host.
+********************************************************************************/
+uint32 Bench_GetTicks(void);
+
+/*******************************************************************************
+* Service Name: Bench_DioWriteChannel
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Legacy - Timing of the channel write path used before the
+*                            resolved channel table
+*                   Resolved - Timing of Dio_WriteChannel
+* Return value: None
+* Description: Writes BenchConf_CHANNEL_ID high and low BENCH_ITERATIONS times
+*              through both paths. Dio_Init must have been called.
+********************************************************************************/
+void Bench_DioWriteChannel(Bench_ResultType * Legacy, Bench_ResultType * Resolved);
+
+/*******************************************************************************
+* Service Name: Bench_Toggle
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Apb - Timing of BENCH_ITERATIONS pin toggles through the APB aperture
+*                   Ahb - Timing of BENCH_ITERATIONS pin toggles through the AHB aperture
+* Return value: None
+* Description: Toggles the pin of BenchConf_CHANNEL_ID with back-to-back masked
+*              GPIODATA stores, once per aperture. The port's GPIOHBCTL bit is
+*              switched for each loop and restored afterwards, with the IRQs
+*              masked meanwhile. The pin runs at half the reported rate.
+*              Port_Init must have been called.
+********************************************************************************/
+void Bench_Toggle(Bench_ResultType * Apb, Bench_ResultType * Ahb);
+
+/*******************************************************************************
+* Service Name: Bench_PbusWrite
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Result - Bytes written, ticks and bytes per second
+* Return value: Std_ReturnType - E_NOT_OK if Pbus_Init fails
+* Description: Initializes the parallel bus and writes BENCH_PBUS_BURSTS data
+*              bursts of BENCH_PBUS_BURST_LENGTH bytes. Port_Init and Dio_Init
+*              must have been called, the bus pins are driven.
+********************************************************************************/
+Std_ReturnType Bench_PbusWrite(Bench_ResultType * Result);
+
+/*******************************************************************************
+* Service Name: Bench_Run
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Runs every benchmark and stores the results in Bench_Report.
+********************************************************************************/
+void Bench_Run(void);
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
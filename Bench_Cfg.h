@@ -0,0 +1,38 @@
+/**********************************************************************************
+ Module		: Bench
+ File Name	: Bench_Cfg.h
+ Author		: Yasser Waleed
+ Description    : Header file containing the benchmark configurations: loop
+		  lengths, benchmarked channel, parallel bus burst and core clock.
+***********************************************************************************/
+#ifndef BENCH_CFG_H
+#define BENCH_CFG_H
+/**********************************************************************************
+ VERSIONS CHECK
+***********************************************************************************/
+/* Module Version 1.0.0 */
+#define BENCH_CFG_SW_MAJOR_VERSION                     (1U)
+#define BENCH_CFG_SW_MINOR_VERSION                     (0U)
+#define BENCH_CFG_SW_PATCH_VERSION                     (0U)
+
+/* AUTOSAR Version 4.0.3 */
+#define BENCH_CFG_AR_RELEASE_MAJOR_VERSION             (4U)
+#define BENCH_CFG_AR_RELEASE_MINOR_VERSION             (0U)
+#define BENCH_CFG_AR_RELEASE_PATCH_VERSION             (3U)
+/**********************************************************************************
+ CONFIGURATIONS
+***********************************************************************************/
+#define BENCH_RUN_AT_INIT               (STD_OFF)       /* Init_Task runs Bench_Run, the results land in Bench_Report */
+
+#define BENCH_ITERATIONS                (10000U)        /* Calls timed by every channel loop */
+
+#define BENCH_CPU_CLOCK_HZ              (16000000UL)    /* Core clock counted by DWT_CYCCNT */
+
+/* Dio channel written by the channel loops, its pin must be an output */
+#define BenchConf_CHANNEL_ID            DioConf_LED1_CHANNEL_ID_INDEX
+
+#define BENCH_PBUS_BURST_LENGTH         (256U)          /* Bytes of one Pbus_Write burst */
+
+#define BENCH_PBUS_BURSTS               (16U)           /* Bursts timed by Bench_PbusWrite */
+
+#endif /* BENCH_CFG_H */
@@ -18,6 +18,12 @@
 /* Global variable to hold the button state */
 static uint8 g_button_state = BUTTON_RELEASED;
 
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/* Set by the edge notification, the pin is sampled until its level settles again */
+static volatile uint8 g_button_edge = TRUE;  /* Sample once at start-up to get the initial state */
+static uint8 g_button_settling = FALSE;
+#endif
+
 /*******************************************************************************************************************/
 /* Description: Called by the Button_Init function (only) used to fill the Button configurations structure */
 //static void BUTTON_configurations(void)
@@ -43,15 +49,39 @@ uint8 BUTTON_getState(void)
 }
 
 /*******************************************************************************************************************/
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+void BUTTON_edgeNotification(void)
+{
+    g_button_edge = TRUE;
+}
+#endif
+
 void BUTTON_refreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint8 state;
     
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
 
     /* Count the number of Released times increment if the switch released for 20 ms */
     static uint8 g_Released_Count = 0;
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+    if(g_button_edge == TRUE)
+    {
+        g_button_edge     = FALSE;
+        g_button_settling = TRUE;
+    }
+
+    /* Nothing to do on an idle pin */
+    if(g_button_settling == FALSE)
+    {
+        return;
+    }
+#endif
+    /* Without the edge notification the pin is polled on every call */
+
+    state = DIO_READ_CHANNEL_STATIC(SW1);
     
     if(state == BUTTON_PRESSED)
     {
@@ -69,12 +99,18 @@ void BUTTON_refreshState(void)
 	g_button_state = BUTTON_PRESSED;
 	g_Pressed_Count       = 0;
 	g_Released_Count      = 0;
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+	g_button_settling     = FALSE;
+#endif
     }
     else if(g_Released_Count == 3)
     {
 	g_button_state = BUTTON_RELEASED;
 	g_Released_Count      = 0;
 	g_Pressed_Count       = 0;
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+	g_button_settling     = FALSE;
+#endif
     }
 }
 /*******************************************************************************************************************/
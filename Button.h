@@ -40,4 +40,11 @@ uint8 BUTTON_getState(void);
  */   
 void BUTTON_refreshState(void);
 
+/*
+ * Description: Dio edge notification of the button pin, called from the port interrupt
+ *              on press and release. BUTTON_refreshState only samples the pin after an edge,
+ *              it polls the pin on every call when DIO_EDGE_NOTIFICATION_API is STD_OFF.
+ */
+void BUTTON_edgeNotification(void);
+
 #endif /* BUTTON_H */
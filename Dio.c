@@ -10,7 +10,15 @@
  ******************************************************************************/
 
 #include "Dio.h"
-#include "Dio_Regs.h"
+#include "Gpio_Hw.h"
+
+#if ((DIO_CAPTURE_API == STD_ON) || (DIO_OUTPUT_QUEUE_API == STD_ON) || (DIO_WAVEFORM_API == STD_ON))
+#include "Gptm_Hw.h"
+#endif
+
+#if ((DIO_CAPTURE_API == STD_ON) || (DIO_WAVEFORM_API == STD_ON))
+#include "Udma.h"
+#endif
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
@@ -24,9 +32,205 @@
 
 #endif
 
-STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
+/* Resolved masked DATA address and pin bit of every channel, built by Dio_Init */
+STATIC Dio_ChannelAccessType Dio_ChannelAccess[DIO_CONFIGURED_CHANNLES];
+STATIC const Dio_ConfigPort * Dio_Ports = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/* Commanded output levels, per hardware port */
+uint8 Dio_OutputShadow[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+/* Output pins of every hardware port, copied from GPIODIR by Dio_SyncDirections */
+uint8 Dio_OutputMask[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+/* Levels of every hardware port latched by Dio_LatchInputs, served to the read services */
+uint8 Dio_InputImage[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/* Notification of every pin of every hardware port, resolved by Dio_Init for the port interrupts */
+STATIC Dio_NotificationType Dio_PinNotification[GPIO_HW_NUMBER_OF_PORTS][8];
+#endif
+
+#if (DIO_CAPTURE_API == STD_ON)
+/* Capture timer and its uDMA channel */
+#define DIO_CAPTURE_TIMER          (0U)
+#define DIO_CAPTURE_CHANNEL        UDMA_CH18_TIMER0A
+
+/* One GPIODATA byte per timer request into the next buffer byte, ping-pong between the halves */
+#define DIO_CAPTURE_CONTROL(Half)  (UDMA_CTL_DST_INC_8 | UDMA_CTL_DST_SIZE_8 | UDMA_CTL_SRC_INC_NONE | \
+                                    UDMA_CTL_SRC_SIZE_8 | UDMA_CTL_ARB_1 | UDMA_CTL_XFER_SIZE(Half) | \
+                                    UDMA_CTL_MODE_PINGPONG)
+
+/* Caller ring buffer, its half size (one uDMA control structure each) and the consumer position */
+STATIC uint8 * Dio_CaptureBuffer = NULL_PTR;
+STATIC uint16 Dio_CaptureSize = 0;
+STATIC uint16 Dio_CaptureHalf = 0;
+STATIC uint16 Dio_CaptureTail = 0;
+/* Halves filled by the uDMA and samples consumed since Dio_CaptureStart, both wrap together */
+STATIC volatile uint32 Dio_CaptureCompleted = 0;
+STATIC uint32 Dio_CaptureConsumed = 0;
+#endif
+
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+/************************************************************************************
+* Function Name: Dio_LatchPorts
+* Parameters (in): None
+* Return value: None
+* Description: Reads the GPIODATA of every clocked configured port once into
+*              the input image.
+************************************************************************************/
+STATIC void Dio_LatchPorts(void)
+{
+	for (uint8 port = 0; port < DIO_CONFIGURED_PORTS; port++)
+	{
+		Dio_PortType Port_Num = Dio_Ports[port].Port_Num;
+
+		if(BIT_IS_SET(GPIO_HW_READ(GPIO_HW_PRGPIO_REG), Port_Num))
+		{
+			Dio_InputImage[Port_Num] = (uint8)GPIO_HW_READ(GPIO_HW_PORT(Port_Num)->DATA[GPIO_HW_DATA_ALL_PINS]);
+		}
+		else
+		{
+			/* No Action Required ... the port is not clocked */
+		}
+	}
+}
+
+/************************************************************************************
+* Function Name: Dio_ReadOutputs
+* Parameters (in): Port_Num - Hardware number of the port
+*                  Mask - Output pins of the port to be read
+* Return value: uint8 - Levels of the masked output pins
+* Description: Output pins are not served from the input image, a level written
+*              in this tick must read back at once: from the shadow when there
+*              is one, otherwise with one masked GPIODATA read.
+************************************************************************************/
+STATIC uint8 Dio_ReadOutputs(Dio_PortType Port_Num, uint8 Mask)
+{
+	uint8 levels = 0;
+
+	if(Mask != 0)
+	{
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+		levels = (uint8)(Dio_OutputShadow[Port_Num] & Mask);
+#else
+		levels = (uint8)GPIO_HW_READ(GPIO_HW_PORT(Port_Num)->DATA[Mask]);
+#endif
+	}
+	else
+	{
+		/* No Action Required ... no output pin, no bus access */
+	}
+	return levels;
+}
+#endif
+
+#if (DIO_OUTPUT_QUEUE_API == STD_ON)
+/* Free-running time base of the output queue */
+#define DIO_QUEUE_TIMER            (2U)
+
+/* TRUE once Time is not later than Now, valid for times less than half the time base range apart */
+#define DIO_TIME_REACHED(Time, Now) ((((uint32)(Now) - (uint32)(Time)) & 0xFFFFFFFFUL) < 0x80000000UL)
+
+/* Timed writes sorted by time in a ring, the first one is armed on the timer match */
+STATIC Dio_TimedWriteType Dio_Queue[DIO_OUTPUT_QUEUE_SIZE];
+STATIC uint8 Dio_QueueHead = 0;
+STATIC uint8 Dio_QueueCount = 0;
+#endif
+
+#if (DIO_WAVEFORM_API == STD_ON)
+/* Waveform timer and its uDMA channel */
+#define DIO_WAVEFORM_TIMER         (1U)
+#define DIO_WAVEFORM_CHANNEL       UDMA_CH20_TIMER1A
+
+/* One buffer byte per timer request into the masked GPIODATA word */
+#define DIO_WAVEFORM_CONTROL(Length, Mode) (UDMA_CTL_DST_INC_NONE | UDMA_CTL_DST_SIZE_8 | UDMA_CTL_SRC_INC_8 | \
+                                            UDMA_CTL_SRC_SIZE_8 | UDMA_CTL_ARB_1 | UDMA_CTL_XFER_SIZE(Length) | (Mode))
+
+/* Played buffers, their length and mode, and the buffers completed since Dio_WaveformStart */
+STATIC uint8 * Dio_WaveformBuffer[2] = { NULL_PTR, NULL_PTR };
+STATIC uint16 Dio_WaveformLength = 0;
+STATIC Dio_WaveformModeType Dio_WaveformMode = DIO_WAVEFORM_ONE_SHOT;
+STATIC Dio_WaveformNotificationType Dio_WaveformNotification = NULL_PTR;
+STATIC uint32 Dio_WaveformCompleted = 0;
+STATIC boolean Dio_WaveformBusy = FALSE;
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/* Pins driven by the uDMA, left out of Dio_RefreshOutputs while the waveform plays */
+STATIC uint8 Dio_StreamedPins[GPIO_HW_NUMBER_OF_PORTS];
+STATIC Dio_PortType Dio_WaveformPort = 0;
+#endif
+#endif
+
+/************************************************************************************
+* Function Name: Dio_WriteMasked
+* Parameters (in): Port_Num - Hardware number of the port
+*                  Mask - Pins of the port to be written
+*                  Level - Value to be written
+* Return value: None
+* Description: Writes the masked pins with one GPIODATA store and keeps the
+*              output shadow in step with it.
+************************************************************************************/
+STATIC void Dio_WriteMasked(Dio_PortType Port_Num, uint8 Mask, uint8 Level)
+{
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+	uint32 saved;
+
+	/* The pin store and the shadow update must not be split by another writer */
+	GPIO_HW_ENTER_CRITICAL(saved);
+	GPIO_HW_WRITE(GPIO_HW_PORT(Port_Num)->DATA[Mask], Level);
+	Dio_OutputShadow[Port_Num] = (uint8)((Dio_OutputShadow[Port_Num] & ~Mask) | (Level & Mask));
+	GPIO_HW_EXIT_CRITICAL(saved);
+#else
+	GPIO_HW_WRITE(GPIO_HW_PORT(Port_Num)->DATA[Mask], Level);
+#endif
+}
+
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+/************************************************************************************
+* Function Name: Dio_SyncPort
+* Parameters (in): Port_Num - Hardware number of a clocked port
+* Return value: None
+* Description: Reloads the output pins of the port from GPIODIR. With the shadow,
+*              pins that became outputs join it with their current level.
+************************************************************************************/
+STATIC void Dio_SyncPort(Dio_PortType Port_Num)
+{
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+	uint32 saved;
+	uint8 outputs;
+	uint8 newPins;
+
+	GPIO_HW_ENTER_CRITICAL(saved);
+	outputs = (uint8)GPIO_HW_READ(GPIO_HW_PORT(Port_Num)->DIR);
+#if (DIO_WAVEFORM_API == STD_ON)
+	/* Pins driven by the uDMA stay out of the shadow, as in Dio_RefreshOutputs */
+	outputs &= (uint8)~Dio_StreamedPins[Port_Num];
+#endif
+	newPins = (uint8)(outputs & ~Dio_OutputMask[Port_Num]);
+	if(newPins != 0)
+	{
+		Dio_OutputShadow[Port_Num] = (uint8)((Dio_OutputShadow[Port_Num] & ~newPins) |
+		                                     (GPIO_HW_READ(GPIO_HW_PORT(Port_Num)->DATA[newPins]) & newPins));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	Dio_OutputMask[Port_Num] = outputs;
+	GPIO_HW_EXIT_CRITICAL(saved);
+#else
+	Dio_OutputMask[Port_Num] = (uint8)GPIO_HW_READ(GPIO_HW_PORT(Port_Num)->DIR);
+#endif
+}
+#endif
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -55,7 +259,95 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 		 * This global pointer is global to be used by other functions to read the PB configuration structures
 		 */
 		Dio_Status       = DIO_INITIALIZED;
-		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		Dio_Ports        = ConfigPtr->Ports;    /* address of the first Ports structure --> Ports[0] */
+
+		/* Resolve every channel once so the channel services do one load and one store */
+		for (uint8 channel = 0; channel < DIO_CONFIGURED_CHANNLES; channel++)
+		{
+			uint8 bit = (uint8)(1U << ConfigPtr->Channels[channel].Ch_Num);
+
+			Dio_ChannelAccess[channel].Data  = &GPIO_HW_PORT(ConfigPtr->Channels[channel].Port_Num)->DATA[bit];
+			Dio_ChannelAccess[channel].Value = bit;
+			Dio_ChannelAccess[channel].Port_Num = ConfigPtr->Channels[channel].Port_Num;
+		}
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+		/* Configure the edge detection of the notified pins, their interrupt stays masked until enabled */
+		for (uint8 notification = 0; notification < DIO_CONFIGURED_NOTIFICATIONS; notification++)
+		{
+			const Dio_ConfigNotification * Notif = &ConfigPtr->Notifications[notification];
+			Dio_PortType port = ConfigPtr->Channels[Notif->Channel].Port_Num;
+			uint8 pin = ConfigPtr->Channels[Notif->Channel].Ch_Num;
+			Gpio_RegsType * Regs = GPIO_HW_PORT(port);
+
+			GPIO_HW_CLEAR_BITS(Regs->IM, 1UL << pin);     /* Mask the pin while its sense is changed */
+			GPIO_HW_CLEAR_BITS(Regs->IS, 1UL << pin);     /* Edge sensitive */
+			if(DIO_EDGE_BOTH == Notif->Edge)
+			{
+				GPIO_HW_SET_BITS(Regs->IBE, 1UL << pin);  /* Both edges, GPIOIEV is ignored */
+			}
+			else
+			{
+				GPIO_HW_CLEAR_BITS(Regs->IBE, 1UL << pin);
+				if(DIO_EDGE_RISING == Notif->Edge)
+				{
+					GPIO_HW_SET_BITS(Regs->IEV, 1UL << pin);
+				}
+				else
+				{
+					GPIO_HW_CLEAR_BITS(Regs->IEV, 1UL << pin);
+				}
+			}
+			GPIO_HW_WRITE(Regs->ICR, 1UL << pin);/* Drop any edge latched by the sense change */
+
+			Dio_PinNotification[port][pin] = Notif->Notification;
+		}
+#endif
+
+#if (DIO_OUTPUT_QUEUE_API == STD_ON)
+		/* Free-running 32-bit up-counter, its match interrupt commits the queued writes */
+		{
+			Gptm_RegsType * Timer = GPTM_HW_TIMER(DIO_QUEUE_TIMER);
+			uint8 irq = GPTM_HW_TIMERA_IRQ(DIO_QUEUE_TIMER);
+
+			Gptm_Hw_EnableTimer(DIO_QUEUE_TIMER);
+			Timer->CFG   = GPTM_HW_CFG_32_BIT;
+			Timer->TAMR  = GPTM_HW_TAMR_PERIODIC | GPTM_HW_TAMR_TACDIR | GPTM_HW_TAMR_TAMIE;
+			Timer->TAILR = 0xFFFFFFFFUL;
+			Timer->IMR   = 0;
+			Timer->ICR   = GPTM_HW_INT_TAM;
+			Dio_QueueHead  = 0;
+			Dio_QueueCount = 0;
+
+			GPIO_HW_NVIC_SET_PRIORITY(irq, DIO_OUTPUT_QUEUE_PRIORITY);
+			GPIO_HW_NVIC_EN_REG(irq) = (1UL << (irq & 0x1FU));
+			Timer->CTL |= GPTM_HW_CTL_TAEN;
+		}
+#endif
+
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+		/* The reads are served from the image, so it must be valid from the start */
+		Dio_LatchPorts();
+#endif
+
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+		/* Start the output pins, and the shadow from the levels Port_Init left on them, of the clocked ports */
+		for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+		{
+			Dio_OutputMask[port]   = 0;
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+			Dio_OutputShadow[port] = 0;
+#endif
+			if(BIT_IS_SET(GPIO_HW_READ(GPIO_HW_PRGPIO_REG), port))
+			{
+				Dio_SyncPort(port);
+			}
+			else
+			{
+				/* No Action Required ... the port is not clocked */
+			}
+		}
+#endif
 	}
 }
 
@@ -73,7 +365,6 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,32 +396,25 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
+		const Dio_ChannelAccessType * Access = &Dio_ChannelAccess[ChannelId];
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+		if((Level == STD_HIGH) || (Level == STD_LOW))
+		{
+			Dio_WriteMasked(Access->Port_Num, Access->Value, (Level == STD_HIGH) ? Access->Value : 0);
 		}
+#else
+		/* The resolved DATA address masks the channel pin, so one store writes it alone */
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			GPIO_HW_WRITE(*Access->Data, Access->Value);
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			GPIO_HW_WRITE(*Access->Data, 0);
 		}
+#endif
 	}
 	else
 	{
@@ -152,7 +436,6 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,24 +468,29 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		const Dio_ChannelAccessType * Access = &Dio_ChannelAccess[ChannelId];
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+		/* Output channels are served from the shadow, Dio_SyncDirections keeps the output pins current */
+		if(Dio_OutputMask[Access->Port_Num] & Access->Value)
+		{
+			output = (Dio_OutputShadow[Access->Port_Num] & Access->Value) ? STD_HIGH : STD_LOW;
+		}
+		else
+#elif (DIO_INPUT_SNAPSHOT == STD_ON)
+		/* Output channels are not latched, a write of this tick must read back at once */
+		if(Dio_OutputMask[Access->Port_Num] & Access->Value)
+		{
+			output = (GPIO_HW_READ(*Access->Data) != 0) ? STD_HIGH : STD_LOW;
+		}
+		else
+#endif
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+		/* Read the required input channel from the inputs latched for this tick */
+		if(Dio_InputImage[Access->Port_Num] & Access->Value)
+#else
+		/* Read the required channel, the other pins read as 0 through the resolved address */
+		if(GPIO_HW_READ(*Access->Data) != 0)
+#endif
 		{
 			output = STD_HIGH;
 		}
@@ -219,60 +507,140 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 }
 
 /************************************************************************************
-* Service Name: Dio_GetVersionInfo
-* Service ID[hex]: 0x12
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): None
+* Parameters (in): PortId - ID of DIO Port.
 * Parameters (inout): None
-* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
-* Return value: None
-* Description: Function to get the version information of this module.
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
 ************************************************************************************/
-#if (DIO_VERSION_INFO_API == STD_ON)
-void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 {
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
-	/* Check if input pointer is not Null pointer */
-	if(NULL_PTR == versioninfo)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
-		/* Report to DET  */
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
 	}
 	else
-#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
 	{
-		/* Copy the vendor Id */
-		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
-		/* Copy the module Id */
-		versioninfo->moduleID = (uint16)DIO_MODULE_ID;
-		/* Copy Software Major Version */
-		versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
-		/* Copy Software Minor Version */
-		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
-		/* Copy Software Patch Version */
-		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+		Dio_PortType Port_Num = Dio_Ports[PortId].Port_Num;
+
+		/* Input pins from the levels latched for this tick, output pins as driven now */
+		output = (Dio_PortLevelType)(Dio_InputImage[Port_Num] & ~Dio_OutputMask[Port_Num]);
+		output |= Dio_ReadOutputs(Port_Num, Dio_OutputMask[Port_Num]);
+#else
+		/* Read the 8 pins at once through the all-pins DATA aperture */
+		output = (Dio_PortLevelType)GPIO_HW_READ(GPIO_HW_PORT(Dio_Ports[PortId].Port_Num)->DATA[GPIO_HW_DATA_ALL_PINS]);
+#endif
+	}
+	else
+	{
+		/* No Action Required */
 	}
+        return output;
 }
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of all channels of that port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
 #endif
 
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Single store through the all-pins DATA aperture, the input pins ignore it */
+		Dio_WriteMasked(Dio_Ports[PortId].Port_Num, GPIO_HW_DATA_ALL_PINS, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
 /************************************************************************************
-* Service Name: Dio_FlipChannel
-* Service ID[hex]: 0x11
+* Service Name: Dio_MaskedWritePort
+* Service ID[hex]: 0x13
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+*                  Mask - Channels of the port to be written.
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: Dio_LevelType
-* Description: Function to flip the level of a channel and return the level of the channel after flip.
+* Return value: None
+* Description: Function to set the level of the masked channels of that port.
+*              The mask selects the GPIODATA address so the store only reaches
+*              the masked pins, no read-modify-write and no interrupt race.
 ************************************************************************************/
-#if (DIO_FLIP_CHANNEL_API == STD_ON)
-Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
-	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -280,19 +648,19 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
 		error = TRUE;
 	}
 	else
 	{
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortId)
 	{
 
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
 		error = TRUE;
 	}
 	else
@@ -304,33 +672,1474 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel and write the required level */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
-		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_LOW;
-		}
-		else
-		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_HIGH;
-		}
+		/* Address bits [9:2] of the store select the pins it affects */
+		Dio_WriteMasked(Dio_Ports[PortId].Port_Num, Mask, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port,
+*              shifted down to the LSB.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the group pointer is not a NULL_PTR */
+	else if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the group belongs to a configured port */
+	else if (DIO_CONFIGURED_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+		Dio_PortType Port_Num = Dio_Ports[ChannelGroupIdPtr->PortIndex].Port_Num;
+		uint8 outputs = (uint8)(Dio_OutputMask[Port_Num] & ChannelGroupIdPtr->mask);
+
+		/* Input pins of the group from the levels latched for this tick, output pins as driven now */
+		output = (Dio_PortLevelType)((((Dio_InputImage[Port_Num] & ChannelGroupIdPtr->mask) & ~outputs)
+		                              | Dio_ReadOutputs(Port_Num, outputs)) >> ChannelGroupIdPtr->offset);
+#else
+		/* The masked DATA aperture reads the group pins only, the other bits read as 0 */
+		output = (Dio_PortLevelType)(GPIO_HW_READ(GPIO_HW_PORT(Dio_Ports[ChannelGroupIdPtr->PortIndex].Port_Num)->DATA[ChannelGroupIdPtr->mask])
+		                             >> ChannelGroupIdPtr->offset);
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to the
+*              given level, with one store through the masked DATA aperture.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the group pointer is not a NULL_PTR */
+	else if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the group belongs to a configured port */
+	else if (DIO_CONFIGURED_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Only the group pins take the shifted level, the rest of the port is untouched */
+		Dio_WriteMasked(Dio_Ports[ChannelGroupIdPtr->PortIndex].Port_Num, ChannelGroupIdPtr->mask,
+		                (uint8)(Level << ChannelGroupIdPtr->offset));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_BeginTransaction
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Transaction - Transaction to be started.
+* Return value: None
+* Description: Function to start a transaction with no pending channel levels.
+************************************************************************************/
+#if (DIO_TRANSACTION_API == STD_ON)
+void Dio_BeginTransaction(Dio_TransactionType * Transaction)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == Transaction)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_BEGIN_TRANSACTION_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+		{
+			Transaction->Mask[port]  = 0;
+			Transaction->Level[port] = 0;
+		}
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_SetTransactionChannel
+* Service ID[hex]: 0x15
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written at commit.
+* Parameters (inout): Transaction - Transaction holding the pending levels.
+* Parameters (out): None
+* Return value: None
+* Description: Function to add a channel level to a transaction, the pins are
+*              only written by Dio_CommitTransaction.
+************************************************************************************/
+#if (DIO_TRANSACTION_API == STD_ON)
+void Dio_SetTransactionChannel(Dio_TransactionType * Transaction, Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_SET_TRANSACTION_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == Transaction)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_SET_TRANSACTION_CHANNEL_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_SET_TRANSACTION_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		const Dio_ChannelAccessType * Access = &Dio_ChannelAccess[ChannelId];
+
+		Transaction->Mask[Access->Port_Num] |= Access->Value;
+		if(Level == STD_HIGH)
+		{
+			Transaction->Level[Access->Port_Num] |= Access->Value;
+		}
+		else
+		{
+			Transaction->Level[Access->Port_Num] &= (uint8)~Access->Value;
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_CommitTransaction
+* Service ID[hex]: 0x16
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Transaction - Transaction holding the pending levels.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the pending channel levels with one masked
+*              GPIODATA store per port. The stores are issued back to back with
+*              the interrupts masked so the output edges stay aligned.
+************************************************************************************/
+#if (DIO_TRANSACTION_API == STD_ON)
+void Dio_CommitTransaction(const Dio_TransactionType * Transaction)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_COMMIT_TRANSACTION_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == Transaction)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_COMMIT_TRANSACTION_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		uint32 saved;
+
+		GPIO_HW_ENTER_CRITICAL(saved);
+		for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+		{
+			if(Transaction->Mask[port] != 0)
+			{
+				/* Address bits [9:2] of the store select the pending pins of this port */
+				Dio_WriteMasked(port, Transaction->Mask[port], Transaction->Level[port]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		GPIO_HW_EXIT_CRITICAL(saved);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_RefreshOutputs
+* Service ID[hex]: 0x17
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): MismatchMasks - Optional, per hardware port the output pins
+*                                   whose level disagreed with the shadow.
+* Return value: Std_ReturnType - E_NOT_OK if any output pin disagreed.
+* Description: Function to re-assert the commanded levels of all output pins
+*              with one masked GPIODATA store per port. Pins turned into outputs
+*              after Dio_Init join the shadow with their current level.
+************************************************************************************/
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+Std_ReturnType Dio_RefreshOutputs(uint8 * MismatchMasks)
+{
+	Std_ReturnType result = E_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_REFRESH_OUTPUTS_SID, DIO_E_UNINIT);
+		error = TRUE;
+		result = E_NOT_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+		{
+			uint8 mismatch = 0;
+
+			if(BIT_IS_SET(GPIO_HW_READ(GPIO_HW_PRGPIO_REG), port))
+			{
+				Gpio_RegsType * Regs = GPIO_HW_PORT(port);
+				uint32 saved;
+
+				GPIO_HW_ENTER_CRITICAL(saved);
+				{
+#if (DIO_WAVEFORM_API == STD_ON)
+					uint8 outputs  = (uint8)(GPIO_HW_READ(Regs->DIR) & ~(uint32)Dio_StreamedPins[port]);
+#else
+					uint8 outputs  = (uint8)GPIO_HW_READ(Regs->DIR);
+#endif
+					uint8 levels   = (uint8)GPIO_HW_READ(Regs->DATA[outputs]);
+					uint8 newPins  = (uint8)(outputs & ~Dio_OutputMask[port]);
+
+					Dio_OutputShadow[port] = (uint8)((Dio_OutputShadow[port] & ~newPins) | (levels & newPins));
+					Dio_OutputMask[port]   = outputs;
+					mismatch = (uint8)((levels ^ Dio_OutputShadow[port]) & outputs);
+
+					GPIO_HW_WRITE(Regs->DATA[outputs], Dio_OutputShadow[port]);
+				}
+				GPIO_HW_EXIT_CRITICAL(saved);
+			}
+			else
+			{
+				/* No Action Required ... the port is not clocked */
+			}
+
+			if(mismatch != 0)
+			{
+				result = E_NOT_OK;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			if(NULL_PTR != MismatchMasks)
+			{
+				MismatchMasks[port] = mismatch;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_SyncDirections
+* Service ID[hex]: 0x24
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to reload the output pins of every clocked port from
+*              GPIODIR. The read services tell outputs from inputs with this RAM
+*              copy instead of a GPIODIR read per call, so it is called after a
+*              Port service changes the direction of a pin read through Dio.
+************************************************************************************/
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+void Dio_SyncDirections(void)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_SYNC_DIRECTIONS_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		uint32 ready = GPIO_HW_READ(GPIO_HW_PRGPIO_REG);
+
+		for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+		{
+			if(BIT_IS_SET(ready, port))
+			{
+				Dio_SyncPort(port);
+			}
+			else
+			{
+				/* No Action Required ... the port is not clocked */
+			}
+		}
+	}
+}
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Function Name: Dio_PortIsr
+* Parameters (in): Port_Num - Hardware number of the interrupting port
+* Return value: None
+* Description: Acknowledges the pending edges of the port and calls the
+*              notification of every pin that saw its configured edge.
+************************************************************************************/
+STATIC void Dio_PortIsr(Dio_PortType Port_Num)
+{
+	Gpio_RegsType * Regs = GPIO_HW_PORT(Port_Num);
+	uint8 pending = (uint8)GPIO_HW_READ(Regs->MIS);
+
+	/* Clear first so an edge during the callbacks raises the interrupt again */
+	GPIO_HW_WRITE(Regs->ICR, pending);
+
+	for (uint8 pin = 0; pin < 8; pin++)
+	{
+		if(BIT_IS_SET(pending, pin) && (NULL_PTR != Dio_PinNotification[Port_Num][pin]))
+		{
+			(*Dio_PinNotification[Port_Num][pin])();
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+
+/************************************************************************************
+* Service Name: GPIOPortx_Handler
+* Description: GPIO port interrupt ISRs
+************************************************************************************/
+void GPIOPortA_Handler(void) { Dio_PortIsr(0); }
+void GPIOPortB_Handler(void) { Dio_PortIsr(1); }
+void GPIOPortC_Handler(void) { Dio_PortIsr(2); }
+void GPIOPortD_Handler(void) { Dio_PortIsr(3); }
+void GPIOPortE_Handler(void) { Dio_PortIsr(4); }
+void GPIOPortF_Handler(void) { Dio_PortIsr(5); }
+
+/************************************************************************************
+* Function Name: Dio_SetNotificationMask
+* Parameters (in): ChannelId - ID of DIO channel
+*                  ServiceId - Calling service, for the DET report
+*                  Enable - TRUE to unmask the channel edge interrupt
+* Return value: None
+* Description: Common body of Dio_EnableNotification/Dio_DisableNotification.
+************************************************************************************/
+STATIC void Dio_SetNotificationMask(Dio_ChannelType ChannelId, uint8 ServiceId, boolean Enable)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				ServiceId, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				ServiceId, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		const Dio_ChannelAccessType * Access = &Dio_ChannelAccess[ChannelId];
+		Gpio_RegsType * Regs = GPIO_HW_PORT(Access->Port_Num);
+		uint8 irq = GPIO_HW_PORT_IRQ(Access->Port_Num);
+		uint32 saved;
+
+		/* GPIOIM is shared by the pins of the port */
+		GPIO_HW_ENTER_CRITICAL(saved);
+		if(TRUE == Enable)
+		{
+			GPIO_HW_WRITE(Regs->ICR, Access->Value);/* Ignore the edges seen while disabled */
+			GPIO_HW_SET_BITS(Regs->IM, Access->Value);
+			GPIO_HW_NVIC_EN_REG(irq) = (1UL << (irq & 0x1FU));
+		}
+		else
+		{
+			GPIO_HW_CLEAR_BITS(Regs->IM, Access->Value);
+			/* The port interrupt stays enabled in the NVIC, the masked pins cannot raise it */
+		}
+		GPIO_HW_EXIT_CRITICAL(saved);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_EnableNotification
+* Service ID[hex]: 0x18
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the edge notification configured for a channel.
+************************************************************************************/
+void Dio_EnableNotification(Dio_ChannelType ChannelId)
+{
+	Dio_SetNotificationMask(ChannelId, DIO_ENABLE_NOTIFICATION_SID, TRUE);
+}
+
+/************************************************************************************
+* Service Name: Dio_DisableNotification
+* Service ID[hex]: 0x19
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the edge notification of a channel.
+************************************************************************************/
+void Dio_DisableNotification(Dio_ChannelType ChannelId)
+{
+	Dio_SetNotificationMask(ChannelId, DIO_DISABLE_NOTIFICATION_SID, FALSE);
+}
+#endif
+
+#if (DIO_CAPTURE_API == STD_ON)
+/************************************************************************************
+* Function Name: Dio_CaptureWritten
+* Parameters (in): None
+* Parameters (out): Head - Write index of the uDMA in the ring buffer
+* Return value: uint32 - Samples written since Dio_CaptureStart, modulo 2^32
+* Description: Progress of the half being filled. A half completed but not yet
+*              re-armed reads as 0 remaining, which counts it as full.
+************************************************************************************/
+STATIC uint32 Dio_CaptureWritten(uint16 * Head)
+{
+	uint32 completed;
+	uint16 filled;
+	uint32 saved;
+
+	GPIO_HW_ENTER_CRITICAL(saved);
+	completed = Dio_CaptureCompleted;
+	filled    = (uint16)(Dio_CaptureHalf - Udma_GetRemaining(DIO_CAPTURE_CHANNEL, (completed & 1U) ? TRUE : FALSE));
+	GPIO_HW_EXIT_CRITICAL(saved);
+
+	*Head = (uint16)(((completed & 1U) ? Dio_CaptureHalf : 0U) + filled);
+	return (completed * Dio_CaptureHalf) + filled;
+}
+
+/************************************************************************************
+* Service Name: Dio_CaptureStart
+* Service ID[hex]: 0x1A
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortId - ID of the sampled DIO Port.
+*                  Buffer - Caller ring buffer receiving one port sample per byte.
+*                  Size - Buffer size in samples, even, 2 to 2048.
+*                  PeriodTicks - Sample period in system clock ticks.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if a capture is already running or
+*                                PeriodTicks is 0.
+* Description: Function to start sampling the port GPIODATA every PeriodTicks.
+*              TIMER0A time-outs request uDMA channel 18 which copies the port
+*              into the two halves of the buffer in ping-pong, so no CPU time
+*              is spent per sample.
+************************************************************************************/
+Std_ReturnType Dio_CaptureStart(Dio_PortType PortId, uint8 * Buffer, uint16 Size, uint32 PeriodTicks)
+{
+	Std_ReturnType result = E_NOT_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_START_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used port is within the valid range */
+	else if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_START_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == Buffer)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_START_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Each half of the buffer is moved by one uDMA control structure */
+	else if ((Size < 2U) || ((Size % 2U) != 0U) || (Size > (2U * UDMA_MAX_TRANSFER_SIZE)))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_START_SID, DIO_E_PARAM_BUFFER_SIZE);
+		error = TRUE;
+	}
+	/* The timer reloads PeriodTicks - 1 */
+	else if (0U == PeriodTicks)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_START_SID, DIO_E_PARAM_PERIOD);
+		error = TRUE;
+	}
+	else if (NULL_PTR != Dio_CaptureBuffer)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_START_SID, DIO_E_CAPTURE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if((FALSE == error) && (NULL_PTR == Dio_CaptureBuffer) && (0U != PeriodTicks))
+	{
+		Gptm_RegsType * Timer = GPTM_HW_TIMER(DIO_CAPTURE_TIMER);
+		volatile uint32 * Data = &GPIO_HW_PORT(Dio_Ports[PortId].Port_Num)->DATA[GPIO_HW_DATA_ALL_PINS];
+		uint8 irq = GPTM_HW_TIMERA_IRQ(DIO_CAPTURE_TIMER);
+
+		Dio_CaptureBuffer    = Buffer;
+		Dio_CaptureSize      = Size;
+		Dio_CaptureHalf      = Size / 2U;
+		Dio_CaptureTail      = 0;
+		Dio_CaptureCompleted = 0;
+		Dio_CaptureConsumed  = 0;
+
+		/* Periodic 32-bit timer, its time-outs only request the uDMA */
+		Gptm_Hw_EnableTimer(DIO_CAPTURE_TIMER);
+		Timer->CFG   = GPTM_HW_CFG_32_BIT;
+		Timer->TAMR  = GPTM_HW_TAMR_PERIODIC;
+		Timer->TAILR = PeriodTicks - 1UL;
+		Timer->IMR   = 0;
+		Timer->ICR   = GPTM_HW_INT_TATO;
+
+		/* Primary structure fills the first half, alternate the second one */
+		Udma_Init();
+		Udma_ConfigureChannel(DIO_CAPTURE_CHANNEL, UDMA_ENC_0);
+		Udma_SetTransfer(DIO_CAPTURE_CHANNEL, FALSE, Data, &Buffer[Dio_CaptureHalf - 1U], DIO_CAPTURE_CONTROL(Dio_CaptureHalf));
+		Udma_SetTransfer(DIO_CAPTURE_CHANNEL, TRUE,  Data, &Buffer[Size - 1U], DIO_CAPTURE_CONTROL(Dio_CaptureHalf));
+		Udma_EnableChannel(DIO_CAPTURE_CHANNEL);
+
+		/* The completion of each half raises the TIMER0A interrupt to re-arm it */
+		GPIO_HW_NVIC_EN_REG(irq) = (1UL << (irq & 0x1FU));
+		Timer->CTL |= GPTM_HW_CTL_TAEN;
+
+		result = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+
+/************************************************************************************
+* Service Name: Dio_CaptureStop
+* Service ID[hex]: 0x1B
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the capture and release the caller buffer.
+************************************************************************************/
+void Dio_CaptureStop(void)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if a capture is running */
+	if (NULL_PTR == Dio_CaptureBuffer)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_STOP_SID, DIO_E_CAPTURE_STATE);
+	}
+	else
+#endif
+	{
+		uint8 irq = GPTM_HW_TIMERA_IRQ(DIO_CAPTURE_TIMER);
+
+		GPTM_HW_TIMER(DIO_CAPTURE_TIMER)->CTL &= ~GPTM_HW_CTL_TAEN;
+		Udma_DisableChannel(DIO_CAPTURE_CHANNEL);
+		GPIO_HW_NVIC_DIS_REG(irq) = (1UL << (irq & 0x1FU));
+		Dio_CaptureBuffer = NULL_PTR;
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_CapturePeek
+* Service ID[hex]: 0x1C
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Samples - Oldest unconsumed sample, inside the ring buffer.
+*                   Count - Number of samples readable from Samples without wrapping.
+* Return value: Std_ReturnType - E_NOT_OK if the uDMA overtook the consumer, the
+*                                unconsumed samples were dropped.
+* Description: Function to access the captured samples in place. The samples
+*              stay valid until given back with Dio_CaptureCommit.
+************************************************************************************/
+Std_ReturnType Dio_CapturePeek(const uint8 ** Samples, uint16 * Count)
+{
+	Std_ReturnType result = E_NOT_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointers are not Null pointers */
+	if ((NULL_PTR == Samples) || (NULL_PTR == Count))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_PEEK_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if a capture is running */
+	else if (NULL_PTR == Dio_CaptureBuffer)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_PEEK_SID, DIO_E_CAPTURE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if((FALSE == error) && (NULL_PTR != Dio_CaptureBuffer))
+	{
+		uint16 head;
+		/* Samples written modulo 2^32, only its difference with the consumed count is used */
+		uint32 written   = Dio_CaptureWritten(&head);
+		uint32 available = written - Dio_CaptureConsumed;
+
+		if(available > Dio_CaptureSize)
+		{
+			/* Overrun: restart from the newest sample, the write index in the ring */
+			Dio_CaptureConsumed = written;
+			Dio_CaptureTail     = (head == Dio_CaptureSize) ? 0U : head;
+			*Count = 0;
+		}
+		else
+		{
+			if(available > (uint32)(Dio_CaptureSize - Dio_CaptureTail))
+			{
+				available = (uint32)(Dio_CaptureSize - Dio_CaptureTail);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+			*Count = (uint16)available;
+			result = E_OK;
+		}
+		*Samples = &Dio_CaptureBuffer[Dio_CaptureTail];
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+
+/************************************************************************************
+* Service Name: Dio_CaptureCommit
+* Service ID[hex]: 0x1D
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Count - Number of peeked samples that were consumed.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to give consumed samples back to the capture. Count is
+*              clamped to the samples Dio_CapturePeek returns at this point, so
+*              the consumer never moves past the uDMA or the end of the buffer.
+************************************************************************************/
+void Dio_CaptureCommit(uint16 Count)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if a capture is running */
+	if (NULL_PTR == Dio_CaptureBuffer)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_CAPTURE_COMMIT_SID, DIO_E_CAPTURE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* Without a capture Dio_CaptureSize is 0, nothing to give back */
+	if((FALSE == error) && (NULL_PTR != Dio_CaptureBuffer))
+	{
+		uint16 head;
+		uint32 available = Dio_CaptureWritten(&head) - Dio_CaptureConsumed;
+
+		if(available > Dio_CaptureSize)
+		{
+			/* Overrun: nothing peeked is valid, the next Dio_CapturePeek recovers */
+			available = 0;
+		}
+		else if(available > (uint32)(Dio_CaptureSize - Dio_CaptureTail))
+		{
+			available = (uint32)(Dio_CaptureSize - Dio_CaptureTail);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		if(Count > available)
+		{
+			Count = (uint16)available;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		Dio_CaptureConsumed += Count;
+		Dio_CaptureTail = (uint16)((Dio_CaptureTail + Count) % Dio_CaptureSize);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Timer0A_Handler
+* Description: TIMER0A ISR, re-arms the capture half the uDMA just filled
+************************************************************************************/
+void Timer0A_Handler(void)
+{
+	if(TRUE == Udma_IsChannelDone(DIO_CAPTURE_CHANNEL))
+	{
+		Udma_ClearChannelDone(DIO_CAPTURE_CHANNEL);
+		/* The uDMA is now filling the other half, this one is next after it */
+		Udma_SetControl(DIO_CAPTURE_CHANNEL, (Dio_CaptureCompleted & 1U) ? TRUE : FALSE,
+		                DIO_CAPTURE_CONTROL(Dio_CaptureHalf));
+		Dio_CaptureCompleted++;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	GPTM_HW_TIMER(DIO_CAPTURE_TIMER)->ICR = GPTM_HW_INT_TATO;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_LatchInputs
+* Service ID[hex]: 0x1E
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to sample every configured port once. Until the next
+*              call, the channel, channel group and port reads return these
+*              levels for input pins, so all readers of a tick see the same
+*              coherent inputs. Output pins read back the level last written.
+************************************************************************************/
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+void Dio_LatchInputs(void)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_LATCH_INPUTS_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		Dio_LatchPorts();
+	}
+}
+#endif
+
+#if (DIO_OUTPUT_QUEUE_API == STD_ON)
+/************************************************************************************
+* Function Name: Dio_ServiceQueue
+* Parameters (in): None
+* Return value: None
+* Description: Commits every due timed write, then arms the timer match on the
+*              next one. A write that falls due while it is being armed is
+*              committed at once instead of waiting for a whole timer wrap.
+*              Called with the interrupts masked or from the match ISR.
+************************************************************************************/
+STATIC void Dio_ServiceQueue(void)
+{
+	Gptm_RegsType * Timer = GPTM_HW_TIMER(DIO_QUEUE_TIMER);
+	boolean armed = FALSE;
+
+	while((Dio_QueueCount != 0) && (FALSE == armed))
+	{
+		const Dio_TimedWriteType * Next = &Dio_Queue[Dio_QueueHead];
+
+		if(DIO_TIME_REACHED(Next->Time, Timer->TAV))
+		{
+			Dio_WriteMasked(Next->Port_Num, Next->Mask, Next->Level);
+			Dio_QueueHead = (uint8)((Dio_QueueHead + 1U) % DIO_OUTPUT_QUEUE_SIZE);
+			Dio_QueueCount--;
+		}
+		else
+		{
+			Timer->TAMATCHR = Next->Time;
+			/* Still ahead after arming, the match will fire for it */
+			armed = DIO_TIME_REACHED(Next->Time, Timer->TAV) ? FALSE : TRUE;
+		}
+	}
+
+	if(TRUE == armed)
+	{
+		Timer->IMR |= GPTM_HW_INT_TAM;
+	}
+	else
+	{
+		Timer->IMR &= ~GPTM_HW_INT_TAM;
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_GetTime
+* Service ID[hex]: 0x1F
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the output queue time base.
+* Description: Function to read the time base the queued writes are timed on,
+*              counting DIO_TICKS_PER_US ticks per microsecond.
+************************************************************************************/
+uint32 Dio_GetTime(void)
+{
+	return (uint32)GPTM_HW_TIMER(DIO_QUEUE_TIMER)->TAV;
+}
+
+/************************************************************************************
+* Service Name: Dio_QueueWrite
+* Service ID[hex]: 0x20
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant
+* Parameters (in): Time - Time base value at which the write is committed,
+*                         less than half the time base range ahead.
+*                  PortId - ID of DIO Port.
+*                  Mask - Channels of the port to be written.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the queue is full.
+* Description: Function to queue a masked port write committed by the TIMER2A
+*              match ISR at the given time. Writes queued for the same time
+*              are committed in the order they were queued.
+************************************************************************************/
+Std_ReturnType Dio_QueueWrite(uint32 Time, Dio_PortType PortId, Dio_PortLevelType Mask, Dio_PortLevelType Level)
+{
+	Std_ReturnType result = E_NOT_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_QUEUE_WRITE_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used port is within the valid range */
+	else if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_QUEUE_WRITE_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		uint32 saved;
+
+		GPIO_HW_ENTER_CRITICAL(saved);
+		if(Dio_QueueCount < DIO_OUTPUT_QUEUE_SIZE)
+		{
+			uint8 slot = Dio_QueueCount;
+
+			/* Insertion from the back keeps the ring sorted, later writes move up one slot */
+			while((slot != 0) &&
+			      !DIO_TIME_REACHED(Dio_Queue[(Dio_QueueHead + slot - 1U) % DIO_OUTPUT_QUEUE_SIZE].Time, Time))
+			{
+				Dio_Queue[(Dio_QueueHead + slot) % DIO_OUTPUT_QUEUE_SIZE] =
+				    Dio_Queue[(Dio_QueueHead + slot - 1U) % DIO_OUTPUT_QUEUE_SIZE];
+				slot--;
+			}
+			Dio_Queue[(Dio_QueueHead + slot) % DIO_OUTPUT_QUEUE_SIZE].Time     = Time;
+			Dio_Queue[(Dio_QueueHead + slot) % DIO_OUTPUT_QUEUE_SIZE].Port_Num = Dio_Ports[PortId].Port_Num;
+			Dio_Queue[(Dio_QueueHead + slot) % DIO_OUTPUT_QUEUE_SIZE].Mask     = Mask;
+			Dio_Queue[(Dio_QueueHead + slot) % DIO_OUTPUT_QUEUE_SIZE].Level    = Level;
+			Dio_QueueCount++;
+
+			/* Re-arm when the new write became the first one */
+			if(slot == 0)
+			{
+				Dio_ServiceQueue();
+			}
+			else
+			{
+				/* No Action Required */
+			}
+			result = E_OK;
+		}
+		else
+		{
+			/* No Action Required ... the queue is full */
+		}
+		GPIO_HW_EXIT_CRITICAL(saved);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+
+/************************************************************************************
+* Service Name: Dio_ClearQueue
+* Service ID[hex]: 0x21
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to drop every pending timed write.
+************************************************************************************/
+void Dio_ClearQueue(void)
+{
+	uint32 saved;
+
+	GPIO_HW_ENTER_CRITICAL(saved);
+	Dio_QueueCount = 0;
+	GPTM_HW_TIMER(DIO_QUEUE_TIMER)->IMR &= ~GPTM_HW_INT_TAM;
+	GPIO_HW_EXIT_CRITICAL(saved);
+}
+
+/************************************************************************************
+* Service Name: Timer2A_Handler
+* Description: TIMER2A match ISR, commits the timed writes that fell due
+************************************************************************************/
+void Timer2A_Handler(void)
+{
+	GPTM_HW_TIMER(DIO_QUEUE_TIMER)->ICR = GPTM_HW_INT_TAM;
+	Dio_ServiceQueue();
+}
+#endif
+
+#if (DIO_WAVEFORM_API == STD_ON)
+/************************************************************************************
+* Function Name: Dio_WaveformHalt
+* Parameters (in): None
+* Return value: None
+* Description: Stops the timer and the uDMA channel, and hands the streamed
+*              pins back to the output shadow with the level they were left at.
+************************************************************************************/
+STATIC void Dio_WaveformHalt(void)
+{
+	uint8 irq = GPTM_HW_TIMERA_IRQ(DIO_WAVEFORM_TIMER);
+
+	GPTM_HW_TIMER(DIO_WAVEFORM_TIMER)->CTL &= ~GPTM_HW_CTL_TAEN;
+	Udma_DisableChannel(DIO_WAVEFORM_CHANNEL);
+	GPIO_HW_NVIC_DIS_REG(irq) = (1UL << (irq & 0x1FU));
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+	{
+		uint8 pins = Dio_StreamedPins[Dio_WaveformPort];
+		uint8 levels = (uint8)GPIO_HW_READ(GPIO_HW_PORT(Dio_WaveformPort)->DATA[pins]);
+
+		Dio_OutputShadow[Dio_WaveformPort] = (uint8)((Dio_OutputShadow[Dio_WaveformPort] & ~pins) | levels);
+		Dio_StreamedPins[Dio_WaveformPort] = 0;
+	}
+#endif
+	Dio_WaveformBusy = FALSE;
+}
+
+/************************************************************************************
+* Service Name: Dio_WaveformStart
+* Service ID[hex]: 0x22
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortId - ID of the driven DIO Port.
+*                  Mask - Channels of the port driven by the waveform.
+*                  Mode - One-shot, loop or double-buffered stream.
+*                  Buffer0 - Port values, one per sample period.
+*                  Buffer1 - Second buffer of the stream mode, unused otherwise.
+*                  Length - Samples per buffer, 1 to 1024.
+*                  PeriodTicks - Sample period in system clock ticks.
+*                  Notification - Optional, called with every buffer played.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if a waveform is already playing or
+*                                PeriodTicks is 0.
+* Description: Function to stream port values into the masked GPIODATA word of
+*              the port: TIMER1A time-outs request uDMA channel 20, which moves
+*              one value per request. The CPU only runs on buffer completion to
+*              re-arm the loop or stream and to let the caller refill.
+************************************************************************************/
+Std_ReturnType Dio_WaveformStart(Dio_PortType PortId, Dio_PortLevelType Mask, Dio_WaveformModeType Mode,
+                                 uint8 * Buffer0, uint8 * Buffer1, uint16 Length, uint32 PeriodTicks,
+                                 Dio_WaveformNotificationType Notification)
+{
+	Std_ReturnType result = E_NOT_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_START_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	/* Check if the used port is within the valid range */
+	else if (DIO_CONFIGURED_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_START_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	/* Check if input pointers are not Null pointers */
+	else if ((NULL_PTR == Buffer0) || ((DIO_WAVEFORM_STREAM == Mode) && (NULL_PTR == Buffer1)))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_START_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* A buffer is moved by one uDMA control structure */
+	else if ((Length == 0U) || (Length > UDMA_MAX_TRANSFER_SIZE))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_START_SID, DIO_E_PARAM_BUFFER_SIZE);
+		error = TRUE;
+	}
+	/* The timer reloads PeriodTicks - 1 */
+	else if (0U == PeriodTicks)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_START_SID, DIO_E_PARAM_PERIOD);
+		error = TRUE;
+	}
+	else if (TRUE == Dio_WaveformBusy)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_START_SID, DIO_E_WAVEFORM_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if((FALSE == error) && (FALSE == Dio_WaveformBusy) && (0U != PeriodTicks))
+	{
+		Gptm_RegsType * Timer = GPTM_HW_TIMER(DIO_WAVEFORM_TIMER);
+		Dio_PortType Port_Num = Dio_Ports[PortId].Port_Num;
+		volatile uint32 * Data = &GPIO_HW_PORT(Port_Num)->DATA[Mask];
+		uint8 irq = GPTM_HW_TIMERA_IRQ(DIO_WAVEFORM_TIMER);
+
+		Dio_WaveformBuffer[0]    = Buffer0;
+		Dio_WaveformBuffer[1]    = (DIO_WAVEFORM_STREAM == Mode) ? Buffer1 : Buffer0;
+		Dio_WaveformLength       = Length;
+		Dio_WaveformMode         = Mode;
+		Dio_WaveformNotification = Notification;
+		Dio_WaveformCompleted    = 0;
+		Dio_WaveformBusy         = TRUE;
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+		Dio_WaveformPort           = Port_Num;
+		Dio_StreamedPins[Port_Num] = Mask;
+#endif
+
+		/* Periodic 32-bit timer, its time-outs only request the uDMA */
+		Gptm_Hw_EnableTimer(DIO_WAVEFORM_TIMER);
+		Timer->CFG   = GPTM_HW_CFG_32_BIT;
+		Timer->TAMR  = GPTM_HW_TAMR_PERIODIC;
+		Timer->TAILR = PeriodTicks - 1UL;
+		Timer->IMR   = 0;
+		Timer->ICR   = GPTM_HW_INT_TATO;
+
+		/* One-shot plays the primary structure alone, loop and stream alternate both in ping-pong */
+		Udma_Init();
+		Udma_ConfigureChannel(DIO_WAVEFORM_CHANNEL, UDMA_ENC_0);
+		if(DIO_WAVEFORM_ONE_SHOT == Mode)
+		{
+			Udma_SetTransfer(DIO_WAVEFORM_CHANNEL, FALSE, &Buffer0[Length - 1U], Data,
+			                 DIO_WAVEFORM_CONTROL(Length, UDMA_CTL_MODE_BASIC));
+		}
+		else
+		{
+			Udma_SetTransfer(DIO_WAVEFORM_CHANNEL, FALSE, &Dio_WaveformBuffer[0][Length - 1U], Data,
+			                 DIO_WAVEFORM_CONTROL(Length, UDMA_CTL_MODE_PINGPONG));
+			Udma_SetTransfer(DIO_WAVEFORM_CHANNEL, TRUE,  &Dio_WaveformBuffer[1][Length - 1U], Data,
+			                 DIO_WAVEFORM_CONTROL(Length, UDMA_CTL_MODE_PINGPONG));
+		}
+		Udma_EnableChannel(DIO_WAVEFORM_CHANNEL);
+
+		GPIO_HW_NVIC_EN_REG(irq) = (1UL << (irq & 0x1FU));
+		Timer->CTL |= GPTM_HW_CTL_TAEN;
+
+		result = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+
+/************************************************************************************
+* Service Name: Dio_WaveformStop
+* Service ID[hex]: 0x23
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the waveform, the pins keep their last value.
+************************************************************************************/
+void Dio_WaveformStop(void)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if a waveform is playing */
+	if (FALSE == Dio_WaveformBusy)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WAVEFORM_STOP_SID, DIO_E_WAVEFORM_STATE);
+	}
+	else
+#endif
+	{
+		Dio_WaveformHalt();
+	}
+}
+
+/************************************************************************************
+* Service Name: Timer1A_Handler
+* Description: TIMER1A ISR, ends a one-shot or re-arms the buffer just played
+************************************************************************************/
+void Timer1A_Handler(void)
+{
+	if(TRUE == Udma_IsChannelDone(DIO_WAVEFORM_CHANNEL))
+	{
+		uint8 played = (uint8)(Dio_WaveformCompleted & 1U);
+
+		Udma_ClearChannelDone(DIO_WAVEFORM_CHANNEL);
+		if(DIO_WAVEFORM_ONE_SHOT == Dio_WaveformMode)
+		{
+			Dio_WaveformHalt();
+		}
+		else
+		{
+			/* The uDMA plays the other buffer now, this one follows it again */
+			Udma_SetControl(DIO_WAVEFORM_CHANNEL, (played != 0U) ? TRUE : FALSE,
+			                DIO_WAVEFORM_CONTROL(Dio_WaveformLength, UDMA_CTL_MODE_PINGPONG));
+		}
+		Dio_WaveformCompleted++;
+
+		if(NULL_PTR != Dio_WaveformNotification)
+		{
+			/* In stream mode the caller refills this buffer before its next turn */
+			(*Dio_WaveformNotification)(Dio_WaveformBuffer[played]);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	GPTM_HW_TIMER(DIO_WAVEFORM_TIMER)->ICR = GPTM_HW_INT_TATO;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_GetVersionInfo
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (DIO_VERSION_INFO_API == STD_ON)
+void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)DIO_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_FlipChannel
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to flip the level of a channel and return the level of the channel after flip.
+************************************************************************************/
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		const Dio_ChannelAccessType * Access = &Dio_ChannelAccess[ChannelId];
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+		uint32 saved;
+
+		/* Flip the commanded level kept in the shadow, no bus read */
+		GPIO_HW_ENTER_CRITICAL(saved);
+		Dio_OutputShadow[Access->Port_Num] ^= Access->Value;
+		GPIO_HW_WRITE(*Access->Data, Dio_OutputShadow[Access->Port_Num]);
+		output = (Dio_OutputShadow[Access->Port_Num] & Access->Value) ? STD_HIGH : STD_LOW;
+		GPIO_HW_EXIT_CRITICAL(saved);
+#else
+		/* Read the required channel and write the required level */
+		if(GPIO_HW_READ(*Access->Data) != 0)
+		{
+			GPIO_HW_WRITE(*Access->Data, 0);
+			output = STD_LOW;
+		}
+		else
+		{
+			GPIO_HW_WRITE(*Access->Data, Access->Value);
+			output = STD_HIGH;
+		}
+#endif
 	}
 	else
 	{
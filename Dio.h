@@ -71,6 +71,7 @@
 
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
+#include "Gpio_Hw.h"
 
 /******************************************************************************
  *                      API Service Id Macros                                 *
@@ -102,6 +103,60 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO masked write Port */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
+/* Service ID for DIO begin Transaction */
+#define DIO_BEGIN_TRANSACTION_SID      (uint8)0x14
+
+/* Service ID for DIO set Transaction Channel */
+#define DIO_SET_TRANSACTION_CHANNEL_SID (uint8)0x15
+
+/* Service ID for DIO commit Transaction */
+#define DIO_COMMIT_TRANSACTION_SID     (uint8)0x16
+
+/* Service ID for DIO refresh Outputs */
+#define DIO_REFRESH_OUTPUTS_SID        (uint8)0x17
+
+/* Service ID for DIO enable Notification */
+#define DIO_ENABLE_NOTIFICATION_SID    (uint8)0x18
+
+/* Service ID for DIO disable Notification */
+#define DIO_DISABLE_NOTIFICATION_SID   (uint8)0x19
+
+/* Service ID for DIO start Capture */
+#define DIO_CAPTURE_START_SID          (uint8)0x1A
+
+/* Service ID for DIO stop Capture */
+#define DIO_CAPTURE_STOP_SID           (uint8)0x1B
+
+/* Service ID for DIO peek Capture */
+#define DIO_CAPTURE_PEEK_SID           (uint8)0x1C
+
+/* Service ID for DIO commit Capture */
+#define DIO_CAPTURE_COMMIT_SID         (uint8)0x1D
+
+/* Service ID for DIO latch Inputs */
+#define DIO_LATCH_INPUTS_SID           (uint8)0x1E
+
+/* Service ID for DIO get Time */
+#define DIO_GET_TIME_SID               (uint8)0x1F
+
+/* Service ID for DIO queue Write */
+#define DIO_QUEUE_WRITE_SID            (uint8)0x20
+
+/* Service ID for DIO clear Queue */
+#define DIO_CLEAR_QUEUE_SID            (uint8)0x21
+
+/* Service ID for DIO start Waveform */
+#define DIO_WAVEFORM_START_SID         (uint8)0x22
+
+/* Service ID for DIO stop Waveform */
+#define DIO_WAVEFORM_STOP_SID          (uint8)0x23
+
+/* Service ID for DIO sync Directions */
+#define DIO_SYNC_DIRECTIONS_SID        (uint8)0x24
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -123,6 +178,18 @@
  */
 #define DIO_E_PARAM_POINTER             (uint8)0x20
 
+/* DET code to report a capture buffer size that is odd, too small or too large */
+#define DIO_E_PARAM_BUFFER_SIZE        (uint8)0x21
+
+/* DET code to report a service called in the wrong capture state */
+#define DIO_E_CAPTURE_STATE            (uint8)0x22
+
+/* DET code to report a service called in the wrong waveform state */
+#define DIO_E_WAVEFORM_STATE           (uint8)0x23
+
+/* DET code to report a timer period of 0 ticks */
+#define DIO_E_PARAM_PERIOD             (uint8)0x24
+
 /*
  * API service used without module initialization is reported using following
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
@@ -163,26 +230,272 @@ typedef struct
 	Dio_ChannelType Ch_Num;
 }Dio_ConfigChannel;
 
+typedef struct
+{
+	/* Member contains the hardware number of the Port (0 = PORTA ... 5 = PORTF) */
+	Dio_PortType Port_Num;
+}Dio_ConfigPort;
+
+/* Channel access resolved by Dio_Init: DATA address masking the channel pin and the pin bit */
+typedef struct
+{
+	volatile uint32 * Data;
+	uint8 Value;
+	/* Hardware number of the channel port, used to batch transaction writes per port */
+	Dio_PortType Port_Num;
+}Dio_ChannelAccessType;
+
+/* Pending channel levels of a transaction, one pin mask and level per hardware port */
+typedef struct
+{
+	uint8 Mask[GPIO_HW_NUMBER_OF_PORTS];
+	uint8 Level[GPIO_HW_NUMBER_OF_PORTS];
+}Dio_TransactionType;
+
+/* Input edges that raise a channel notification */
+typedef enum
+{
+	DIO_EDGE_RISING,
+	DIO_EDGE_FALLING,
+	DIO_EDGE_BOTH
+}Dio_EdgeType;
+
+/* Callback called from the port interrupt when the configured edge is detected */
+typedef void (*Dio_NotificationType)(void);
+
+typedef struct
+{
+	/* Member contains the ID of the notified Channel */
+	Dio_ChannelType Channel;
+	/* Member contains the detected edge */
+	Dio_EdgeType Edge;
+	/* Member contains the callback */
+	Dio_NotificationType Notification;
+}Dio_ConfigNotification;
+
+/* Timed write held by the output queue */
+typedef struct
+{
+	/* Time base value at which the write is committed */
+	uint32 Time;
+	/* Hardware number of the written port */
+	Dio_PortType Port_Num;
+	/* Written pins and their level */
+	uint8 Mask;
+	uint8 Level;
+}Dio_TimedWriteType;
+
+/* Playback modes of the waveform generator */
+typedef enum
+{
+	DIO_WAVEFORM_ONE_SHOT,   /* Buffer0 is played once */
+	DIO_WAVEFORM_LOOP,       /* Buffer0 is played again and again */
+	DIO_WAVEFORM_STREAM      /* Buffer0 and Buffer1 alternate, each is refilled while the other plays */
+}Dio_WaveformModeType;
+
+/* Callback called from the waveform ISR with the buffer that was just played */
+typedef void (*Dio_WaveformNotificationType)(uint8 * Buffer);
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ConfigPort Ports[DIO_CONFIGURED_PORTS];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_CHANNEL_GROUPS];
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+	Dio_ConfigNotification Notifications[DIO_CONFIGURED_NOTIFICATIONS];
+#endif
 } Dio_ConfigType;
 
+/* The output shadow and the input snapshot tell outputs from inputs with a RAM
+ * copy of GPIODIR, kept by Dio_SyncDirections instead of a GPIODIR read per call */
+#if ((DIO_OUTPUT_SHADOW == STD_ON) || (DIO_INPUT_SNAPSHOT == STD_ON))
+#define DIO_SYNC_DIRECTIONS_API          (STD_ON)
+#else
+#define DIO_SYNC_DIRECTIONS_API          (STD_OFF)
+#endif
+
+/*******************************************************************************
+ *                      Constant Channel Fast Path                             *
+ *******************************************************************************/
+/*
+ * Compile-time variants of the channel services for constant channels. Name is
+ * the channel name used in Dio_Cfg.h (e.g. LED1): the port and pin are resolved
+ * from DioConf_<Name>_PORT_NUM/CHANNEL_NUM, the range checks of the AUTOSAR API
+ * become static assertions and a write compiles to a single store. There is no
+ * DET reporting, use the AUTOSAR API for variable channel IDs.
+ */
+#define DIO_STATIC_ASSERT(Cond)          ((void)sizeof(char[(Cond) ? 1 : -1]))
+
+#define DIO_CHANNEL_STATIC_CHECK(Name)                                              \
+  (DIO_STATIC_ASSERT(DioConf_##Name##_CHANNEL_ID_INDEX < DIO_CONFIGURED_CHANNLES), \
+   DIO_STATIC_ASSERT(DioConf_##Name##_PORT_NUM < GPIO_HW_NUMBER_OF_PORTS),         \
+   DIO_STATIC_ASSERT(DioConf_##Name##_CHANNEL_NUM < 8U))
+
+/* Pin bit of the channel and its GPIODATA word masking that pin alone */
+#define DIO_CHANNEL_STATIC_BIT(Name)     (1U << DioConf_##Name##_CHANNEL_NUM)
+#define DIO_CHANNEL_STATIC_DATA(Name)    \
+  (GPIO_HW_PORT_STATIC(DioConf_##Name##_PORT_NUM)->DATA[DIO_CHANNEL_STATIC_BIT(Name)])
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/* The shadow is updated together with the pin so Dio_RefreshOutputs re-asserts the new level */
+#define DIO_WRITE_CHANNEL_STATIC(Name, Level)                                       \
+  do {                                                                              \
+    uint32 dio_saved;                                                               \
+    (void)DIO_CHANNEL_STATIC_CHECK(Name);                                           \
+    GPIO_HW_ENTER_CRITICAL(dio_saved);                                              \
+    if((Level) == STD_HIGH)                                                         \
+    {                                                                               \
+      GPIO_HW_WRITE(DIO_CHANNEL_STATIC_DATA(Name), DIO_CHANNEL_STATIC_BIT(Name));   \
+      Dio_OutputShadow[DioConf_##Name##_PORT_NUM] |= (uint8)DIO_CHANNEL_STATIC_BIT(Name); \
+    }                                                                               \
+    else                                                                            \
+    {                                                                               \
+      GPIO_HW_WRITE(DIO_CHANNEL_STATIC_DATA(Name), 0U);                             \
+      Dio_OutputShadow[DioConf_##Name##_PORT_NUM] &= (uint8)~DIO_CHANNEL_STATIC_BIT(Name); \
+    }                                                                               \
+    GPIO_HW_EXIT_CRITICAL(dio_saved);                                               \
+  } while(0)
+#else
+#define DIO_WRITE_CHANNEL_STATIC(Name, Level)                                       \
+  ((void)DIO_CHANNEL_STATIC_CHECK(Name),                                            \
+   (void)GPIO_HW_WRITE(DIO_CHANNEL_STATIC_DATA(Name), ((Level) == STD_HIGH) ? DIO_CHANNEL_STATIC_BIT(Name) : 0U))
+#endif
+
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+/* Commanded level of an output channel: the shadow, or the pin when there is no shadow */
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+#define DIO_OUTPUT_LEVEL_STATIC(Name)                                               \
+  (Dio_OutputShadow[DioConf_##Name##_PORT_NUM] & DIO_CHANNEL_STATIC_BIT(Name))
+#else
+#define DIO_OUTPUT_LEVEL_STATIC(Name)                                               \
+  GPIO_HW_READ(DIO_CHANNEL_STATIC_DATA(Name))
+#endif
+
+/* Inputs are served from the levels latched for this tick and outputs as driven, like Dio_ReadChannel */
+#define DIO_READ_CHANNEL_STATIC(Name)                                               \
+  ((void)DIO_CHANNEL_STATIC_CHECK(Name),                                            \
+   (Dio_LevelType)((((Dio_OutputMask[DioConf_##Name##_PORT_NUM] & DIO_CHANNEL_STATIC_BIT(Name)) != 0U) \
+                    ? (DIO_OUTPUT_LEVEL_STATIC(Name) != 0U)                         \
+                    : ((Dio_InputImage[DioConf_##Name##_PORT_NUM] & DIO_CHANNEL_STATIC_BIT(Name)) != 0U)) ? STD_HIGH : STD_LOW))
+#else
+#define DIO_READ_CHANNEL_STATIC(Name)                                               \
+  ((void)DIO_CHANNEL_STATIC_CHECK(Name),                                            \
+   (Dio_LevelType)((GPIO_HW_READ(DIO_CHANNEL_STATIC_DATA(Name)) != 0U) ? STD_HIGH : STD_LOW))
+#endif
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* Function for DIO masked write Port API */
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask);
+#endif
+
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+#if (DIO_TRANSACTION_API == STD_ON)
+/* Function for DIO begin Transaction API */
+void Dio_BeginTransaction(Dio_TransactionType * Transaction);
+
+/* Function for DIO set Transaction Channel API */
+void Dio_SetTransactionChannel(Dio_TransactionType * Transaction, Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/* Function for DIO commit Transaction API */
+void Dio_CommitTransaction(const Dio_TransactionType * Transaction);
+#endif
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/* Function for DIO refresh Outputs API */
+Std_ReturnType Dio_RefreshOutputs(uint8 * MismatchMasks);
+
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/* Function for DIO enable Notification API */
+void Dio_EnableNotification(Dio_ChannelType ChannelId);
+
+/* Function for DIO disable Notification API */
+void Dio_DisableNotification(Dio_ChannelType ChannelId);
+
+/* GPIO port interrupt handlers dispatching the edge notifications */
+void GPIOPortA_Handler(void);
+void GPIOPortB_Handler(void);
+void GPIOPortC_Handler(void);
+void GPIOPortD_Handler(void);
+void GPIOPortE_Handler(void);
+void GPIOPortF_Handler(void);
+#endif
+
+#if (DIO_CAPTURE_API == STD_ON)
+/* Function for DIO start Capture API */
+Std_ReturnType Dio_CaptureStart(Dio_PortType PortId, uint8 * Buffer, uint16 Size, uint32 PeriodTicks);
+
+/* Function for DIO stop Capture API */
+void Dio_CaptureStop(void);
+
+/* Function for DIO peek Capture API */
+Std_ReturnType Dio_CapturePeek(const uint8 ** Samples, uint16 * Count);
+
+/* Function for DIO commit Capture API */
+void Dio_CaptureCommit(uint16 Count);
+
+/* TIMER0A interrupt handler, raised by the uDMA completion of the capture channel */
+void Timer0A_Handler(void);
+#endif
+
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+/* Function for DIO latch Inputs API */
+void Dio_LatchInputs(void);
+#endif
+
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+/* Function for DIO sync Directions API, called after Port changes the direction of a Dio pin */
+void Dio_SyncDirections(void);
+#endif
+
+#if (DIO_OUTPUT_QUEUE_API == STD_ON)
+/* Function for DIO get Time API */
+uint32 Dio_GetTime(void);
+
+/* Function for DIO queue Write API */
+Std_ReturnType Dio_QueueWrite(uint32 Time, Dio_PortType PortId, Dio_PortLevelType Mask, Dio_PortLevelType Level);
+
+/* Function for DIO clear Queue API */
+void Dio_ClearQueue(void);
+
+/* TIMER2A interrupt handler, commits the due timed writes */
+void Timer2A_Handler(void);
+#endif
+
+#if (DIO_WAVEFORM_API == STD_ON)
+/* Function for DIO start Waveform API */
+Std_ReturnType Dio_WaveformStart(Dio_PortType PortId, Dio_PortLevelType Mask, Dio_WaveformModeType Mode,
+                                 uint8 * Buffer0, uint8 * Buffer1, uint16 Length, uint32 PeriodTicks,
+                                 Dio_WaveformNotificationType Notification);
+
+/* Function for DIO stop Waveform API */
+void Dio_WaveformStop(void);
+
+/* TIMER1A interrupt handler, raised by the uDMA completion of the waveform channel */
+void Timer1A_Handler(void);
+#endif
+
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
 /* Function for DIO Initialization API */
@@ -205,4 +518,19 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /* Extern PB structures to be used by Dio and other modules */
 extern const Dio_ConfigType Dio_Configuration;
 
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+/* Port levels latched by Dio_LatchInputs, indexed by hardware port */
+extern uint8 Dio_InputImage[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/* Commanded output levels of every hardware port, kept by the Dio write services */
+extern uint8 Dio_OutputShadow[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+/* Output pins of every hardware port, kept by Dio_SyncDirections */
+extern uint8 Dio_OutputMask[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+
 #endif /* DIO_H */
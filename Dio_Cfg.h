@@ -35,6 +35,45 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for presence of Dio_MaskedWritePort API */
+#define DIO_MASKED_WRITE_PORT_API           (STD_ON)
+
+/* Pre-compile option for presence of the Dio transaction APIs */
+#define DIO_TRANSACTION_API                 (STD_ON)
+
+/* Pre-compile option for the RAM shadow of the output levels and Dio_RefreshOutputs API.
+ * Off by default: with the shadow every write, DIO_WRITE_CHANNEL_STATIC included, takes a
+ * critical section and a shadow read-modify-write next to its GPIODATA store. Turn it on
+ * only when outputs must be re-asserted after EMI or read back without a bus access.
+ * Overridable from the command line so the host tests also run the shadow build. */
+#ifndef DIO_OUTPUT_SHADOW
+#define DIO_OUTPUT_SHADOW                   (STD_OFF)
+#endif
+
+/* Pre-compile option for the edge notifications of input channels */
+#define DIO_EDGE_NOTIFICATION_API           (STD_ON)
+
+/* Pre-compile option for the timer-paced port capture (TIMER0A requests on uDMA channel 18) */
+#define DIO_CAPTURE_API                     (STD_ON)
+
+/* Pre-compile option for the input snapshot: input pin reads are served from the levels latched once per Os tick */
+#define DIO_INPUT_SNAPSHOT                  (STD_ON)
+
+/* Pre-compile option for the time-triggered output queue (TIMER2A free-running time base and match ISR) */
+#define DIO_OUTPUT_QUEUE_API                (STD_ON)
+
+/* Number of pending timed writes the output queue holds */
+#define DIO_OUTPUT_QUEUE_SIZE               (16U)
+
+/* NVIC priority of the output queue match ISR, the highest so the edges do not jitter */
+#define DIO_OUTPUT_QUEUE_PRIORITY           (0U)
+
+/* Output queue time base ticks per microsecond (system clock 16MHz) */
+#define DIO_TICKS_PER_US                    (16UL)
+
+/* Pre-compile option for the waveform generator (TIMER1A requests on uDMA channel 20) */
+#define DIO_WAVEFORM_API                    (STD_ON)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -50,4 +89,48 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* Number of the configured Dio Ports */
+#define DIO_CONFIGURED_PORTS                 (6U)
+
+/* Port Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_PORTA_PORT_ID_INDEX          (uint8)0x00
+#define DioConf_PORTB_PORT_ID_INDEX          (uint8)0x01
+#define DioConf_PORTC_PORT_ID_INDEX          (uint8)0x02
+#define DioConf_PORTD_PORT_ID_INDEX          (uint8)0x03
+#define DioConf_PORTE_PORT_ID_INDEX          (uint8)0x04
+#define DioConf_PORTF_PORT_ID_INDEX          (uint8)0x05
+
+/* DIO Configured hardware Port numbers */
+#define DioConf_PORTA_PORT_NUM               (Dio_PortType)0 /* PORTA */
+#define DioConf_PORTB_PORT_NUM               (Dio_PortType)1 /* PORTB */
+#define DioConf_PORTC_PORT_NUM               (Dio_PortType)2 /* PORTC */
+#define DioConf_PORTD_PORT_NUM               (Dio_PortType)3 /* PORTD */
+#define DioConf_PORTE_PORT_NUM               (Dio_PortType)4 /* PORTE */
+#define DioConf_PORTF_PORT_NUM               (Dio_PortType)5 /* PORTF */
+
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_CHANNEL_GROUPS        (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LED_GROUP_ID_INDEX       (uint8)0x00
+
+/* DIO Configured Channel Groups: mask, offset and Dio Port ID */
+#define DioConf_RGB_LED_GROUP_MASK           (uint8)0x0E /* Pins 1..3 in PORTF */
+#define DioConf_RGB_LED_GROUP_OFFSET         (uint8)1
+#define DioConf_RGB_LED_GROUP_PORT_INDEX     DioConf_PORTF_PORT_ID_INDEX
+
+/* Channel Group references passed to Dio_ReadChannelGroup/Dio_WriteChannelGroup */
+#define DioConf_RGB_LED_GROUP_PTR            (&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX])
+
+/* Number of the configured Dio edge notifications */
+#define DIO_CONFIGURED_NOTIFICATIONS         (1U)
+
+/* Notification Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_SW1_NOTIFICATION_ID_INDEX    (uint8)0x00
+
+/* DIO Configured edge notifications: channel, edge and callback */
+#define DioConf_SW1_NOTIFICATION_CHANNEL     DioConf_SW1_CHANNEL_ID_INDEX
+#define DioConf_SW1_NOTIFICATION_EDGE        DIO_EDGE_BOTH /* Press and release */
+#define DioConf_SW1_NOTIFICATION_FUNC        BUTTON_edgeNotification
+
 #endif /* DIO_CFG_H */
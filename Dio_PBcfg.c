@@ -11,6 +11,9 @@
 
 #include "Dio.h"
 
+/* Modules owning the notification callbacks */
+#include "Button.h"
+
 /*
  * Module Version 1.0.0
  */
@@ -41,6 +44,25 @@
 
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                             {
+                                               DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
+                                               DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                             },
+                                             {
+                                               DioConf_PORTA_PORT_NUM,
+                                               DioConf_PORTB_PORT_NUM,
+                                               DioConf_PORTC_PORT_NUM,
+                                               DioConf_PORTD_PORT_NUM,
+                                               DioConf_PORTE_PORT_NUM,
+                                               DioConf_PORTF_PORT_NUM
+                                             },
+                                             {
+                                               DioConf_RGB_LED_GROUP_MASK,DioConf_RGB_LED_GROUP_OFFSET,DioConf_RGB_LED_GROUP_PORT_INDEX
+                                             }
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+                                             ,
+                                             {
+                                               DioConf_SW1_NOTIFICATION_CHANNEL,DioConf_SW1_NOTIFICATION_EDGE,DioConf_SW1_NOTIFICATION_FUNC
+                                             }
+#endif
 				         };
\ No newline at end of file
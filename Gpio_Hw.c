@@ -0,0 +1,325 @@
+/********************************************************************************
+ Module	        : Gpio_Hw
+ File Name	: Gpio_Hw.c
+ Author		: Yasser Waleed
+ Description    : Source file holding the GPIO register block table
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Gpio_Hw.h"
+/********************************************************************************
+ REGISTER BLOCKS
+*********************************************************************************/
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+
+Gpio_RegsType Gpio_HostRegs[GPIO_HW_NUMBER_OF_PORTS];
+volatile uint32 Gpio_HostRcgcGpio = 0;
+volatile uint32 Gpio_HostHbctl = 0;
+volatile uint32 Gpio_HostNvicEn[2];
+volatile uint32 Gpio_HostNvicDis[2];
+volatile uint32 Gpio_HostNvicPri[12];
+
+uint32 Gpio_HostReads  [GPIO_HW_NUMBER_OF_PORTS][GPIO_HW_REGS_WORDS];
+uint32 Gpio_HostWrites [GPIO_HW_NUMBER_OF_PORTS][GPIO_HW_REGS_WORDS];
+uint32 Gpio_HostSysReads = 0;
+uint32 Gpio_HostSysWrites = 0;
+
+volatile uint32 Gpio_HostData[GPIO_HW_NUMBER_OF_PORTS];
+
+Gpio_RegsType * const Gpio_PortRegs[GPIO_HW_NUMBER_OF_PORTS] = {
+	&Gpio_HostRegs[0],
+	&Gpio_HostRegs[1],
+	&Gpio_HostRegs[2],
+	&Gpio_HostRegs[3],
+	&Gpio_HostRegs[4],
+	&Gpio_HostRegs[5]
+};
+
+/* Target base address of every port, used to emulate the bit-band alias region */
+static const uint32 Gpio_HostPhysBase[GPIO_HW_NUMBER_OF_PORTS] = {
+	GPIO_HW_PORTA_BASE,
+	GPIO_HW_PORTB_BASE,
+	GPIO_HW_PORTC_BASE,
+	GPIO_HW_PORTD_BASE,
+	GPIO_HW_PORTE_BASE,
+	GPIO_HW_PORTF_BASE
+};
+
+/************************************************************************************
+* Function Name: Gpio_HostLocate
+* Parameters (in): Addr - Address inside one of the RAM-backed register blocks
+* Parameters (out): Port - Port of the register, Word - Word index in the block
+* Return value: boolean - FALSE if Addr is not a GPIO port register
+* Description: Finds the port register block and register word of an address.
+************************************************************************************/
+boolean Gpio_HostLocate(const volatile void * Addr, uint8 * Port, uint16 * Word)
+{
+  const volatile uint32 * Reg = (const volatile uint32 *)Addr;
+
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    /* Word indexing keeps the target offsets whatever the host size of uint32 */
+    const volatile uint32 * Block = (const volatile uint32 *)&Gpio_HostRegs[port];
+
+    if((Reg >= Block) && (Reg < (Block + GPIO_HW_REGS_WORDS)))
+    {
+      *Port = port;
+      *Word = (uint16)(Reg - Block);
+      return TRUE;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+  return FALSE;
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostLoad / Gpio_HostStore
+* Parameters (in): Port - Port of the register, Word - Word index in the block
+*                  Value - Stored value
+* Return value: uint32 - Register value
+* Description: Uncounted register access. The 256 GPIODATA words are one data
+*              word seen through the address mask: bits [7:0] of the word index
+*              select the pins that are read (others read as 0) or written.
+************************************************************************************/
+static uint32 Gpio_HostLoad(uint8 Port, uint16 Word)
+{
+  if(Word < GPIO_HW_DATA_WORDS)
+  {
+    return Gpio_HostData[Port] & (uint32)Word;
+  }
+  else
+  {
+    return ((volatile uint32 *)&Gpio_HostRegs[Port])[Word];
+  }
+}
+
+static void Gpio_HostStore(uint8 Port, uint16 Word, uint32 Value)
+{
+  if(Word < GPIO_HW_DATA_WORDS)
+  {
+    Gpio_HostData[Port] = (Gpio_HostData[Port] & ~(uint32)Word) | (Value & (uint32)Word);
+  }
+  else
+  {
+    ((volatile uint32 *)&Gpio_HostRegs[Port])[Word] = Value;
+  }
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostRead
+* Parameters (in): Reg - Register read by the driver
+* Return value: uint32 - Register value
+* Description: Counts the read of a GPIO port or GPIO system control register,
+*              GPIODATA reads return the pins selected by the address mask.
+************************************************************************************/
+uint32 Gpio_HostRead(const volatile uint32 * Reg)
+{
+  uint8 port;
+  uint16 word;
+
+  if(Gpio_HostLocate(Reg, &port, &word))
+  {
+    Gpio_HostReads[port][word]++;
+    return Gpio_HostLoad(port, word);
+  }
+  else
+  {
+    if((Reg == &Gpio_HostRcgcGpio) || (Reg == &Gpio_HostHbctl))
+    {
+      Gpio_HostSysReads++;
+    }
+    else
+    {
+      /* Do Nothing ... not a GPIO register */
+    }
+    return *Reg;
+  }
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostWrite
+* Parameters (in): Reg - Register written by the driver, Value - Stored value
+* Return value: None
+* Description: Counts the write of a GPIO port or GPIO system control register,
+*              GPIODATA writes only change the pins selected by the address mask.
+************************************************************************************/
+void Gpio_HostWrite(volatile uint32 * Reg, uint32 Value)
+{
+  uint8 port;
+  uint16 word;
+
+  if(Gpio_HostLocate(Reg, &port, &word))
+  {
+    Gpio_HostWrites[port][word]++;
+    Gpio_HostStore(port, word, Value);
+  }
+  else
+  {
+    if((Reg == &Gpio_HostRcgcGpio) || (Reg == &Gpio_HostHbctl))
+    {
+      Gpio_HostSysWrites++;
+    }
+    else
+    {
+      /* Do Nothing ... not a GPIO register */
+    }
+    *Reg = Value;
+  }
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostResetCounters / Gpio_HostAccessCount
+* Parameters (in): None
+* Return value: uint32 - Reads plus writes counted since the last reset
+* Description: Clears and sums the access counters of the register model.
+************************************************************************************/
+void Gpio_HostResetCounters(void)
+{
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    for (uint16 word = 0; word < GPIO_HW_REGS_WORDS; word++)
+    {
+      Gpio_HostReads[port][word]  = 0;
+      Gpio_HostWrites[port][word] = 0;
+    }
+  }
+  Gpio_HostSysReads  = 0;
+  Gpio_HostSysWrites = 0;
+}
+
+uint32 Gpio_HostAccessCount(void)
+{
+  uint32 count = Gpio_HostSysReads + Gpio_HostSysWrites;
+
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    for (uint16 word = 0; word < GPIO_HW_REGS_WORDS; word++)
+    {
+      count += Gpio_HostReads[port][word] + Gpio_HostWrites[port][word];
+    }
+  }
+  return count;
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostPhysAddress
+* Parameters (in): Reg - Register inside one of the RAM-backed register blocks
+* Return value: uint32 - Address of the same register on the target
+* Description: Translates a RAM-backed register to its target address.
+************************************************************************************/
+uint32 Gpio_HostPhysAddress(const volatile uint32 * Reg)
+{
+  uint8 port;
+  uint16 word;
+
+  if(Gpio_HostLocate(Reg, &port, &word))
+  {
+    return Gpio_HostPhysBase[port] + ((uint32)word << 2);
+  }
+  else
+  {
+    return 0;
+  }
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostBitBandStore
+* Parameters (in): Alias - Address inside the peripheral bit-band alias region
+*                  Value - Bit value, only bit 0 is used as the hardware does
+* Return value: None
+* Description: Decodes the alias address into register and bit and updates the
+*              RAM-backed register like the bus matrix does on the target.
+************************************************************************************/
+void Gpio_HostBitBandStore(uint32 Alias, uint32 Value)
+{
+  uint32 Offset  = Alias - GPIO_HW_PERIPH_ALIAS_BASE;
+  uint32 RegAddr = GPIO_HW_PERIPH_BASE + ((Offset >> 5) & ~0x3UL);
+  uint8  Bit     = (uint8)((Offset >> 2) & 0x1F);
+
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    if((RegAddr >= Gpio_HostPhysBase[port]) && (RegAddr < (Gpio_HostPhysBase[port] + (GPIO_HW_REGS_WORDS << 2))))
+    {
+      uint16 word = (uint16)((RegAddr - Gpio_HostPhysBase[port]) >> 2);
+      uint32 reg  = Gpio_HostLoad(port, word);
+
+      /* One store on the bus, the bit update happens in the bus matrix */
+      Gpio_HostWrites[port][word]++;
+      if(Value & 0x1U)
+      {
+        reg |= (1UL << Bit);
+      }
+      else
+      {
+        reg &= ~(1UL << Bit);
+      }
+      Gpio_HostStore(port, word, reg);
+      return;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+}
+
+/* Scripted input waveform of one port, see Gpio_HostLoadInputScript */
+static uint8 Gpio_HostScriptPort = 0;
+static const uint8 * Gpio_HostScriptLevels = 0;
+static uint16 Gpio_HostScriptCount = 0;
+static uint16 Gpio_HostScriptIndex = 0;
+
+/************************************************************************************
+* Function Name: Gpio_HostLoadInputScript
+* Parameters (in): PortNum - Port whose input levels are scripted
+*                  Levels - Port level of every step, the script repeats
+*                  Count - Number of steps
+* Return value: None
+* Description: Installs an input waveform replayed by Gpio_HostStepInputScript.
+************************************************************************************/
+void Gpio_HostLoadInputScript(uint8 PortNum, const uint8 * Levels, uint16 Count)
+{
+  Gpio_HostScriptPort   = PortNum;
+  Gpio_HostScriptLevels = Levels;
+  Gpio_HostScriptCount  = Count;
+  Gpio_HostScriptIndex  = 0;
+}
+
+/************************************************************************************
+* Function Name: Gpio_HostStepInputScript
+* Parameters (in): None
+* Return value: None
+* Description: Drives the next scripted level on the pins of the scripted port.
+************************************************************************************/
+void Gpio_HostStepInputScript(void)
+{
+  if(Gpio_HostScriptCount != 0)
+  {
+    Gpio_HostData[Gpio_HostScriptPort] = Gpio_HostScriptLevels[Gpio_HostScriptIndex];
+    Gpio_HostScriptIndex = (uint16)((Gpio_HostScriptIndex + 1U) % Gpio_HostScriptCount);
+  }
+  else
+  {
+    /* Do Nothing ... no script loaded */
+  }
+}
+
+#else
+
+Gpio_RegsType * const Gpio_PortRegs[GPIO_HW_NUMBER_OF_PORTS] = {
+	(Gpio_RegsType *)GPIO_HW_PORTA_BASE,
+	(Gpio_RegsType *)GPIO_HW_PORTB_BASE,
+	(Gpio_RegsType *)GPIO_HW_PORTC_BASE,
+	(Gpio_RegsType *)GPIO_HW_PORTD_BASE,
+	(Gpio_RegsType *)GPIO_HW_PORTE_BASE,
+	(Gpio_RegsType *)GPIO_HW_PORTF_BASE
+};
+
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
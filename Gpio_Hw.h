@@ -0,0 +1,255 @@
+/**********************************************************************************
+ Module	     : Gpio_Hw
+ File Name   : Gpio_Hw.h
+ Author	     : Yasser Waleed
+ Description : GPIO hardware-access layer shared by the Port and Dio drivers.
+               Overlays the TM4C123GH6PM GPIO register block with a struct and
+               exposes a const table of the register blocks indexed by port.
+***********************************************************************************/
+#ifndef GPIO_HW_H
+#define GPIO_HW_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "tm4c123gh6pm_registers.h"
+#include "Port_Cfg.h"
+/**********************************************************************************
+ CONFIGURATIONS
+***********************************************************************************/
+/* STD_ON builds the GPIO stack against RAM-backed register blocks (host builds) */
+#ifndef GPIO_HW_HOST_MODEL
+#define GPIO_HW_HOST_MODEL              (STD_OFF)
+#endif
+#if (GPIO_HW_HOST_MODEL == STD_OFF)
+#include <intrinsics.h>
+#endif
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+#define GPIO_HW_NUMBER_OF_PORTS         (6U)            /* PORTA to PORTF */
+
+#define GPIO_HW_DATA_ALL_PINS           (0xFFU)         /* GPIODATA address mask selecting the 8 pins */
+#define GPIO_HW_DATA_WORDS              (256U)          /* GPIODATA words, one per address mask */
+
+#define GPIO_HW_ALL_PORTS_MASK          (0x3FU)         /* One bit per port, PORTA to PORTF */
+
+#define GPIO_HW_UNLOCK_KEY              (0x4C4F434BUL)  /* Value written to GPIOLOCK to unlock GPIOCR */
+
+/* Base address of every port in the aperture selected by PORT_AHB_APERTURE */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define GPIO_HW_PORTA_BASE              GPIO_PORTA_AHB_BASE_ADDRESS
+#define GPIO_HW_PORTB_BASE              GPIO_PORTB_AHB_BASE_ADDRESS
+#define GPIO_HW_PORTC_BASE              GPIO_PORTC_AHB_BASE_ADDRESS
+#define GPIO_HW_PORTD_BASE              GPIO_PORTD_AHB_BASE_ADDRESS
+#define GPIO_HW_PORTE_BASE              GPIO_PORTE_AHB_BASE_ADDRESS
+#define GPIO_HW_PORTF_BASE              GPIO_PORTF_AHB_BASE_ADDRESS
+#else
+#define GPIO_HW_PORTA_BASE              GPIO_PORTA_BASE_ADDRESS
+#define GPIO_HW_PORTB_BASE              GPIO_PORTB_BASE_ADDRESS
+#define GPIO_HW_PORTC_BASE              GPIO_PORTC_BASE_ADDRESS
+#define GPIO_HW_PORTD_BASE              GPIO_PORTD_BASE_ADDRESS
+#define GPIO_HW_PORTE_BASE              GPIO_PORTE_BASE_ADDRESS
+#define GPIO_HW_PORTF_BASE              GPIO_PORTF_BASE_ADDRESS
+#endif
+
+/* Register block of the given port number */
+#define GPIO_HW_PORT(PortNum)           (Gpio_PortRegs[(PortNum)])
+
+/* Register block of a constant port number, folded to a constant address by the compiler */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_PORT_STATIC(PortNum)    (&Gpio_HostRegs[(PortNum)])
+#else
+#define GPIO_HW_PORT_STATIC(PortNum)    ((Gpio_RegsType *)GPIO_HW_PORT_BASE(PortNum))
+#endif
+
+#define GPIO_HW_PORT_BASE(PortNum)                    \
+  (((PortNum) == 0U) ? GPIO_HW_PORTA_BASE :           \
+   ((PortNum) == 1U) ? GPIO_HW_PORTB_BASE :           \
+   ((PortNum) == 2U) ? GPIO_HW_PORTC_BASE :           \
+   ((PortNum) == 3U) ? GPIO_HW_PORTD_BASE :           \
+   ((PortNum) == 4U) ? GPIO_HW_PORTE_BASE :           \
+                       GPIO_HW_PORTF_BASE)
+
+/* Register block of a port in the APB or the AHB aperture, whatever PORT_AHB_APERTURE selects.
+   Only the aperture enabled in GPIOHBCTL decodes, the host model has one block behind both */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_PORT_APB(PortNum)       (&Gpio_HostRegs[(PortNum)])
+#define GPIO_HW_PORT_AHB(PortNum)       (&Gpio_HostRegs[(PortNum)])
+#else
+#define GPIO_HW_PORT_APB(PortNum)                                              \
+  ((Gpio_RegsType *)(uint32)(((PortNum) == 0U) ? GPIO_PORTA_BASE_ADDRESS :     \
+                             ((PortNum) == 1U) ? GPIO_PORTB_BASE_ADDRESS :     \
+                             ((PortNum) == 2U) ? GPIO_PORTC_BASE_ADDRESS :     \
+                             ((PortNum) == 3U) ? GPIO_PORTD_BASE_ADDRESS :     \
+                             ((PortNum) == 4U) ? GPIO_PORTE_BASE_ADDRESS :     \
+                                                 GPIO_PORTF_BASE_ADDRESS))
+#define GPIO_HW_PORT_AHB(PortNum)                                              \
+  ((Gpio_RegsType *)(uint32)(((PortNum) == 0U) ? GPIO_PORTA_AHB_BASE_ADDRESS : \
+                             ((PortNum) == 1U) ? GPIO_PORTB_AHB_BASE_ADDRESS : \
+                             ((PortNum) == 2U) ? GPIO_PORTC_AHB_BASE_ADDRESS : \
+                             ((PortNum) == 3U) ? GPIO_PORTD_AHB_BASE_ADDRESS : \
+                             ((PortNum) == 4U) ? GPIO_PORTE_AHB_BASE_ADDRESS : \
+                                                 GPIO_PORTF_AHB_BASE_ADDRESS))
+#endif
+
+/* GPIO run-mode clock gating and peripheral ready registers, the host ports are ready at once */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_RCGCGPIO_REG            (Gpio_HostRcgcGpio)
+#define GPIO_HW_PRGPIO_REG              (Gpio_HostRcgcGpio)
+#define GPIO_HW_HBCTL_REG               (Gpio_HostHbctl)
+#else
+#define GPIO_HW_RCGCGPIO_REG            SYSCTL_RCGCGPIO_REG
+#define GPIO_HW_PRGPIO_REG              SYSCTL_PRGPIO_REG
+#define GPIO_HW_HBCTL_REG               SYSCTL_GPIOHBCTL_REG
+#endif
+
+/* Register accesses of the GPIO stack: plain volatile accesses on the target, host
+   builds route them through the register model, which counts every access */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_READ(Reg)               Gpio_HostRead(&(Reg))
+#define GPIO_HW_WRITE(Reg, Value)       Gpio_HostWrite(&(Reg), (uint32)(Value))
+#else
+#define GPIO_HW_READ(Reg)               (Reg)
+#define GPIO_HW_WRITE(Reg, Value)       ((Reg) = (uint32)(Value))
+#endif
+
+/* Read-modify-write of some bits of a register */
+#define GPIO_HW_SET_BITS(Reg, Mask)     GPIO_HW_WRITE(Reg, GPIO_HW_READ(Reg) | (uint32)(Mask))
+#define GPIO_HW_CLEAR_BITS(Reg, Mask)   GPIO_HW_WRITE(Reg, GPIO_HW_READ(Reg) & ~(uint32)(Mask))
+#define GPIO_HW_MERGE_BITS(Reg, Mask, Value) \
+  GPIO_HW_WRITE(Reg, (GPIO_HW_READ(Reg) & ~(uint32)(Mask)) | (uint32)(Value))
+
+/* NVIC interrupt number of the port interrupt: PORTA..PORTE are IRQ 0..4 and PORTF is IRQ 30 */
+#define GPIO_HW_PORT_IRQ(PortNum)       (((PortNum) < 5U) ? (uint8)(PortNum) : (uint8)30U)
+
+/* NVIC set-enable and clear-enable word holding the given interrupt number */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_NVIC_EN_REG(Irq)        (Gpio_HostNvicEn[(Irq) >> 5])
+#define GPIO_HW_NVIC_DIS_REG(Irq)       (Gpio_HostNvicDis[(Irq) >> 5])
+#define GPIO_HW_NVIC_PRI_REG(Irq)       (Gpio_HostNvicPri[(Irq) >> 2])
+#else
+#define GPIO_HW_NVIC_EN_REG(Irq)        ((&NVIC_EN0_REG)[(Irq) >> 5])
+#define GPIO_HW_NVIC_DIS_REG(Irq)       ((&NVIC_DIS0_REG)[(Irq) >> 5])
+#define GPIO_HW_NVIC_PRI_REG(Irq)       ((&NVIC_PRI0_REG)[(Irq) >> 2])
+#endif
+
+/* Sets the 3-bit priority of the interrupt, 0 is the highest */
+#define GPIO_HW_NVIC_SET_PRIORITY(Irq, Priority)                                      \
+  (GPIO_HW_NVIC_PRI_REG(Irq) = (GPIO_HW_NVIC_PRI_REG(Irq) & ~(0xE0UL << (((Irq) & 0x3U) * 8U))) \
+                               | ((uint32)(Priority) << ((((Irq) & 0x3U) * 8U) + 5U)))
+
+#define GPIO_HW_PERIPH_BASE             (0x40000000UL)  /* Start of the Cortex-M4 peripheral bit-band region */
+#define GPIO_HW_PERIPH_ALIAS_BASE       (0x42000000UL)  /* Start of the peripheral bit-band alias region */
+
+/* Alias word of bit Bit of the peripheral register at physical address RegAddr */
+#define GPIO_HW_BITBAND_ALIAS(RegAddr, Bit) \
+  (GPIO_HW_PERIPH_ALIAS_BASE + (((uint32)(RegAddr) - GPIO_HW_PERIPH_BASE) << 5) + ((uint32)(Bit) << 2))
+
+/* Writes a single register bit with one store to its bit-band alias word (atomic, no read-modify-write) */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_BITBAND_WRITE(Reg, Bit, Value) \
+  Gpio_HostBitBandStore(GPIO_HW_BITBAND_ALIAS(Gpio_HostPhysAddress(&(Reg)), (Bit)), (uint32)(Value))
+#else
+#define GPIO_HW_BITBAND_WRITE(Reg, Bit, Value) \
+  (*(volatile uint32 *)GPIO_HW_BITBAND_ALIAS(&(Reg), (Bit)) = (uint32)(Value))
+#endif
+
+/* Short critical section masking the IRQs, Saved keeps the caller PRIMASK so sections may nest */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPIO_HW_ENTER_CRITICAL(Saved)   ((Saved) = 0U)
+#define GPIO_HW_EXIT_CRITICAL(Saved)    ((void)(Saved))
+#else
+#define GPIO_HW_ENTER_CRITICAL(Saved)   do { (Saved) = __get_PRIMASK(); __disable_interrupt(); } while(0)
+#define GPIO_HW_EXIT_CRITICAL(Saved)    __set_PRIMASK(Saved)
+#endif
+/**********************************************************************************
+ DATA TYPES
+***********************************************************************************/
+/* Overlay of one GPIO port register block */
+typedef struct
+{
+  volatile uint32 DATA[256];            /* 0x000-0x3FC GPIODATA, address bits [9:2] mask the accessed pins (Gpio_HostData in host builds) */
+  volatile uint32 DIR;                  /* 0x400 GPIODIR   */
+  volatile uint32 IS;                   /* 0x404 GPIOIS    */
+  volatile uint32 IBE;                  /* 0x408 GPIOIBE   */
+  volatile uint32 IEV;                  /* 0x40C GPIOIEV   */
+  volatile uint32 IM;                   /* 0x410 GPIOIM    */
+  volatile uint32 RIS;                  /* 0x414 GPIORIS   */
+  volatile uint32 MIS;                  /* 0x418 GPIOMIS   */
+  volatile uint32 ICR;                  /* 0x41C GPIOICR   */
+  volatile uint32 AFSEL;                /* 0x420 GPIOAFSEL */
+  volatile uint32 RESERVED0[55];        /* 0x424-0x4FC     */
+  volatile uint32 DR2R;                 /* 0x500 GPIODR2R  */
+  volatile uint32 DR4R;                 /* 0x504 GPIODR4R  */
+  volatile uint32 DR8R;                 /* 0x508 GPIODR8R  */
+  volatile uint32 ODR;                  /* 0x50C GPIOODR   */
+  volatile uint32 PUR;                  /* 0x510 GPIOPUR   */
+  volatile uint32 PDR;                  /* 0x514 GPIOPDR   */
+  volatile uint32 SLR;                  /* 0x518 GPIOSLR   */
+  volatile uint32 DEN;                  /* 0x51C GPIODEN   */
+  volatile uint32 LOCK;                 /* 0x520 GPIOLOCK  */
+  volatile uint32 CR;                   /* 0x524 GPIOCR    */
+  volatile uint32 AMSEL;                /* 0x528 GPIOAMSEL */
+  volatile uint32 PCTL;                 /* 0x52C GPIOPCTL  */
+  volatile uint32 ADCCTL;               /* 0x530 GPIOADCCTL */
+  volatile uint32 DMACTL;               /* 0x534 GPIODMACTL */
+} Gpio_RegsType;
+
+#define GPIO_HW_REGS_WORDS              (0x538U / 4U)   /* 32-bit registers in Gpio_RegsType */
+/**********************************************************************************
+ EXTERNAL VARIABLES
+***********************************************************************************/
+/* Register block of every port, indexed by the port number (0 = PORTA ... 5 = PORTF) */
+extern Gpio_RegsType * const Gpio_PortRegs[GPIO_HW_NUMBER_OF_PORTS];
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/* RAM-backed register blocks and system control registers used by host builds */
+extern Gpio_RegsType Gpio_HostRegs[GPIO_HW_NUMBER_OF_PORTS];
+extern volatile uint32 Gpio_HostRcgcGpio;
+extern volatile uint32 Gpio_HostHbctl;
+extern volatile uint32 Gpio_HostNvicEn[2];
+extern volatile uint32 Gpio_HostNvicDis[2];
+extern volatile uint32 Gpio_HostNvicPri[12];
+
+/* Accesses counted by the register model: per port and register word, and on RCGCGPIO/PRGPIO/GPIOHBCTL */
+extern uint32 Gpio_HostReads  [GPIO_HW_NUMBER_OF_PORTS][GPIO_HW_REGS_WORDS];
+extern uint32 Gpio_HostWrites [GPIO_HW_NUMBER_OF_PORTS][GPIO_HW_REGS_WORDS];
+extern uint32 Gpio_HostSysReads;
+extern uint32 Gpio_HostSysWrites;
+
+/* Pin levels of every port: the one data word all the GPIODATA addresses share,
+   an access to DATA[Mask] only reads or changes the pins in Mask */
+extern volatile uint32 Gpio_HostData[GPIO_HW_NUMBER_OF_PORTS];
+#endif
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/* Register model accesses behind GPIO_HW_READ and GPIO_HW_WRITE */
+uint32 Gpio_HostRead(const volatile uint32 * Reg);
+void Gpio_HostWrite(volatile uint32 * Reg, uint32 Value);
+
+/* Finds the port and register word of an address, FALSE if it is not a GPIO port register */
+boolean Gpio_HostLocate(const volatile void * Addr, uint8 * Port, uint16 * Word);
+
+/* Clears the access counters, and sums them: reads plus writes of all the GPIO registers */
+void Gpio_HostResetCounters(void);
+uint32 Gpio_HostAccessCount(void);
+
+/* Physical address the given RAM-backed register has on the target */
+uint32 Gpio_HostPhysAddress(const volatile uint32 * Reg);
+
+/* Maps a bit-band alias address back to its register bit and applies the store */
+void Gpio_HostBitBandStore(uint32 Alias, uint32 Value);
+
+/* Scripted input waveform: Levels[i] is the port level at step i, the script repeats */
+void Gpio_HostLoadInputScript(uint8 PortNum, const uint8 * Levels, uint16 Count);
+
+/* Applies the next scripted level, called once per simulated sample period */
+void Gpio_HostStepInputScript(void);
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
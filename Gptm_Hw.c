@@ -0,0 +1,58 @@
+/********************************************************************************
+ Module	        : Gptm_Hw
+ File Name	: Gptm_Hw.c
+ Author		: Yasser Waleed
+ Description    : Source file holding the general-purpose timer register block table
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Gptm_Hw.h"
+#include "Common_Macros.h"
+/********************************************************************************
+ REGISTER BLOCKS
+*********************************************************************************/
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+
+Gptm_RegsType Gptm_HostRegs[GPTM_HW_NUMBER_OF_TIMERS];
+volatile uint32 Gptm_HostRcgcTimer = 0;
+
+Gptm_RegsType * const Gptm_TimerRegs[GPTM_HW_NUMBER_OF_TIMERS] = {
+	&Gptm_HostRegs[0],
+	&Gptm_HostRegs[1],
+	&Gptm_HostRegs[2]
+};
+
+#else
+
+Gptm_RegsType * const Gptm_TimerRegs[GPTM_HW_NUMBER_OF_TIMERS] = {
+	(Gptm_RegsType *)GPTM_TIMER0_BASE_ADDRESS,
+	(Gptm_RegsType *)GPTM_TIMER1_BASE_ADDRESS,
+	(Gptm_RegsType *)GPTM_TIMER2_BASE_ADDRESS
+};
+
+#endif
+/********************************************************************************
+ FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Function Name: Gptm_Hw_EnableTimer
+* Parameters (in): TimerNum - Timer number (0 = TIMER0 ... 2 = TIMER2)
+* Return value: None
+* Description: Enables the run-mode clock of the timer, waits for PRTIMER to
+*              report it ready and stops timer A before it is configured.
+************************************************************************************/
+void Gptm_Hw_EnableTimer(uint8 TimerNum)
+{
+  GPTM_HW_RCGCTIMER_REG |= (1UL << TimerNum);
+
+  while(BIT_IS_CLEAR(GPTM_HW_PRTIMER_REG, TimerNum))
+  {
+    /* Wait for the timer to be ready */
+  }
+
+  GPTM_HW_TIMER(TimerNum)->CTL &= ~GPTM_HW_CTL_TAEN;
+}
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
@@ -0,0 +1,94 @@
+/**********************************************************************************
+ Module	     : Gptm_Hw
+ File Name   : Gptm_Hw.h
+ Author	     : Yasser Waleed
+ Description : General-purpose timer hardware-access layer. Overlays the
+               TM4C123GH6PM 16/32-bit timer register block with a struct and
+               exposes a const table of the timer blocks indexed by timer.
+***********************************************************************************/
+#ifndef GPTM_HW_H
+#define GPTM_HW_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "tm4c123gh6pm_registers.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+#define GPTM_HW_NUMBER_OF_TIMERS        (3U)            /* TIMER0 to TIMER2 */
+
+/* Register block of the given timer number */
+#define GPTM_HW_TIMER(TimerNum)         (Gptm_TimerRegs[(TimerNum)])
+
+/* NVIC interrupt number of timer A: TIMER0A = 19, TIMER1A = 21, TIMER2A = 23 */
+#define GPTM_HW_TIMERA_IRQ(TimerNum)    ((uint8)(19U + (2U * (TimerNum))))
+
+/* Timer run-mode clock gating and peripheral ready registers, the host timers are ready at once */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define GPTM_HW_RCGCTIMER_REG           (Gptm_HostRcgcTimer)
+#define GPTM_HW_PRTIMER_REG             (Gptm_HostRcgcTimer)
+#else
+#define GPTM_HW_RCGCTIMER_REG           SYSCTL_RCGCTIMER_REG
+#define GPTM_HW_PRTIMER_REG             SYSCTL_PRTIMER_REG
+#endif
+
+/* GPTMCFG, GPTMTAMR, GPTMCTL and interrupt bits used by the drivers */
+#define GPTM_HW_CFG_32_BIT              (0x0U)          /* Concatenated 32-bit timer */
+#define GPTM_HW_TAMR_ONE_SHOT           (0x1U)
+#define GPTM_HW_TAMR_PERIODIC           (0x2U)
+#define GPTM_HW_TAMR_TACDIR             (0x10U)         /* Count up */
+#define GPTM_HW_TAMR_TAMIE              (0x20U)         /* Match interrupt enable */
+#define GPTM_HW_CTL_TAEN                (0x1U)          /* Timer A enable */
+#define GPTM_HW_INT_TATO                (0x1U)          /* Timer A time-out */
+#define GPTM_HW_INT_TAM                 (0x10U)         /* Timer A match */
+/**********************************************************************************
+ DATA TYPES
+***********************************************************************************/
+/* Overlay of one timer register block */
+typedef struct
+{
+  volatile uint32 CFG;                  /* 0x000 GPTMCFG      */
+  volatile uint32 TAMR;                 /* 0x004 GPTMTAMR     */
+  volatile uint32 TBMR;                 /* 0x008 GPTMTBMR     */
+  volatile uint32 CTL;                  /* 0x00C GPTMCTL      */
+  volatile uint32 SYNC;                 /* 0x010 GPTMSYNC     */
+  volatile uint32 RESERVED0;            /* 0x014              */
+  volatile uint32 IMR;                  /* 0x018 GPTMIMR      */
+  volatile uint32 RIS;                  /* 0x01C GPTMRIS      */
+  volatile uint32 MIS;                  /* 0x020 GPTMMIS      */
+  volatile uint32 ICR;                  /* 0x024 GPTMICR      */
+  volatile uint32 TAILR;                /* 0x028 GPTMTAILR    */
+  volatile uint32 TBILR;                /* 0x02C GPTMTBILR    */
+  volatile uint32 TAMATCHR;             /* 0x030 GPTMTAMATCHR */
+  volatile uint32 TBMATCHR;             /* 0x034 GPTMTBMATCHR */
+  volatile uint32 TAPR;                 /* 0x038 GPTMTAPR     */
+  volatile uint32 TBPR;                 /* 0x03C GPTMTBPR     */
+  volatile uint32 TAPMR;                /* 0x040 GPTMTAPMR    */
+  volatile uint32 TBPMR;                /* 0x044 GPTMTBPMR    */
+  volatile uint32 TAR;                  /* 0x048 GPTMTAR      */
+  volatile uint32 TBR;                  /* 0x04C GPTMTBR      */
+  volatile uint32 TAV;                  /* 0x050 GPTMTAV      */
+  volatile uint32 TBV;                  /* 0x054 GPTMTBV      */
+} Gptm_RegsType;
+/**********************************************************************************
+ EXTERNAL VARIABLES
+***********************************************************************************/
+/* Register block of every timer, indexed by the timer number (0 = TIMER0 ... 2 = TIMER2) */
+extern Gptm_RegsType * const Gptm_TimerRegs[GPTM_HW_NUMBER_OF_TIMERS];
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/* RAM-backed timer blocks and clock gating register used by host builds */
+extern Gptm_RegsType Gptm_HostRegs[GPTM_HW_NUMBER_OF_TIMERS];
+extern volatile uint32 Gptm_HostRcgcTimer;
+#endif
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+/* Clocks the timer, waits until it is ready and stops timer A */
+void Gptm_Hw_EnableTimer(uint8 TimerNum);
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
@@ -36,26 +36,32 @@
 /*********************************************************************************************/
 void LED_setOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    DIO_WRITE_CHANNEL_STATIC(LED1,LED_ON);  /* LED ON */
 }
 
 /*********************************************************************************************/
 void LED_setOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    DIO_WRITE_CHANNEL_STATIC(LED1,LED_OFF); /* LED OFF */
 }
 
 /*********************************************************************************************/
 void LED_refreshOutput(void)
 {
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    /* re-write the commanded level of the LED pin only, the other output pins belong to other drivers */
+    Dio_LevelType state = ((Dio_OutputShadow[DioConf_LED1_PORT_NUM] & DIO_CHANNEL_STATIC_BIT(LED1)) != 0U) ? STD_HIGH : STD_LOW;
+    DIO_WRITE_CHANNEL_STATIC(LED1,state);
+#else
     Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
     Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+#endif
 }
 
 /*********************************************************************************************/
 void LED_toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
 }
 
 /*********************************************************************************************/
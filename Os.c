@@ -14,6 +14,7 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Dio.h"
 
 /* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
 #define Enable_Interrupts()    __asm("CPSIE I")
@@ -67,6 +68,10 @@ void Os_Scheduler(void)
 	/* Code is only executed in case there is a new timer tick */
 	if(g_New_Time_Tick_Flag == 1)
 	{
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+	    /* Sample the inputs once, every task of this tick reads the same levels */
+	    Dio_LatchInputs();
+#endif
 	    switch(g_Time_Tick_Count)
             {
 		case 20:
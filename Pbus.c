@@ -0,0 +1,457 @@
+/********************************************************************************
+ Module	        : Pbus
+ File Name	: Pbus.c
+ Author		: Yasser Waleed
+ Description    : Source file of the parallel bus driver
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Pbus.h"
+#include "Port.h"
+#include "Gpio_Hw.h"
+/********************************************************************************
+ DEVELOPMENT ERRORS DETECTION
+*********************************************************************************/
+#if (PBUS_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Pbus Modules */
+#if ((DET_AR_MAJOR_VERSION != PBUS_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != PBUS_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != PBUS_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* The data bus direction is switched through the Port pin set services */
+#if ((PORT_PIN_GROUP_API == STD_OFF) || (PORT_SET_PIN_DIRECTION_API == STD_OFF))
+  #error "Pbus needs PORT_PIN_GROUP_API and PORT_SET_PIN_DIRECTION_API"
+#endif
+
+/* The throughput is measured on the free-running time base of the Dio output queue */
+#if ((PBUS_THROUGHPUT_API == STD_ON) && (DIO_OUTPUT_QUEUE_API == STD_OFF))
+  #error "PBUS_THROUGHPUT_API needs DIO_OUTPUT_QUEUE_API"
+#endif
+/********************************************************************************
+ LOCAL MACROS
+*********************************************************************************/
+/* Masked GPIODATA word of the data bus, a store only changes the bus pins */
+#define PBUS_DATA_REG \
+  (GPIO_HW_PORT_STATIC(PbusConf_DATA_PORT_NUM)->DATA[PbusConf_DATA_MASK])
+
+/* GPIODATA word of a single strobe channel, a store is one atomic pin write */
+#define PBUS_CHANNEL_REG(Name) \
+  (GPIO_HW_PORT_STATIC(PbusConf_##Name##_PORT_NUM)->DATA[1U << PbusConf_##Name##_CHANNEL_NUM])
+
+#define PBUS_CHANNEL_LOW(Name)          GPIO_HW_WRITE(PBUS_CHANNEL_REG(Name), 0x00U)
+#define PBUS_CHANNEL_HIGH(Name)         GPIO_HW_WRITE(PBUS_CHANNEL_REG(Name), 0xFFU)
+
+/* Strobe of one byte: 8080 pulses WR/RD low, 6800 pulses E (WR channel) high */
+#if (PBUS_INTERFACE == PBUS_INTERFACE_8080)
+#define PBUS_WRITE_STROBE_ASSERT()      PBUS_CHANNEL_LOW(WR)
+#define PBUS_WRITE_STROBE_RELEASE()     PBUS_CHANNEL_HIGH(WR)
+#define PBUS_READ_STROBE_ASSERT()       PBUS_CHANNEL_LOW(RD)
+#define PBUS_READ_STROBE_RELEASE()      PBUS_CHANNEL_HIGH(RD)
+#else
+#define PBUS_WRITE_STROBE_ASSERT()      PBUS_CHANNEL_HIGH(WR)
+#define PBUS_WRITE_STROBE_RELEASE()     PBUS_CHANNEL_LOW(WR)
+#define PBUS_READ_STROBE_ASSERT()       PBUS_CHANNEL_HIGH(WR)
+#define PBUS_READ_STROBE_RELEASE()      PBUS_CHANNEL_LOW(WR)
+#endif
+
+/* One write cycle: data on the bus, then the strobe latches it */
+#define PBUS_WRITE_BYTE(Value)                                        \
+  do {                                                                \
+    GPIO_HW_WRITE(PBUS_DATA_REG, (uint32)(Value) << PbusConf_DATA_OFFSET); \
+    PBUS_WRITE_STROBE_ASSERT();                                       \
+    PBUS_WRITE_STROBE_RELEASE();                                      \
+  } while(0)
+
+/* One read cycle: the discarded reads give the device its access time */
+#define PBUS_READ_BYTE(Value)                                         \
+  do {                                                                \
+    PBUS_READ_STROBE_ASSERT();                                        \
+    for (uint8 settle = 0; settle < PBUS_READ_SETTLE_READS; settle++) \
+    {                                                                 \
+      (void)GPIO_HW_READ(PBUS_DATA_REG);                              \
+    }                                                                 \
+    (Value) = (uint8)(GPIO_HW_READ(PBUS_DATA_REG) >> PbusConf_DATA_OFFSET); \
+    PBUS_READ_STROBE_RELEASE();                                       \
+  } while(0)
+
+/* Ticks above which the throughput totals are halved, keeping their ratio */
+#define PBUS_THROUGHPUT_TICKS_LIMIT     (0x80000000UL)
+/********************************************************************************
+ LOCAL VARIABLES
+*********************************************************************************/
+static uint8 Pbus_Status = PBUS_NOT_INITIALIZED;
+
+/* Port pin sets of the data bus and of the strobes */
+static Port_PinSetType Pbus_DataPins;
+static Port_PinSetType Pbus_StrobePins;
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+static uint32 Pbus_Bytes = 0;
+static uint32 Pbus_Ticks = 0;
+#endif
+/********************************************************************************
+ LOCAL FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Function Name: Pbus_SyncShadow
+* Parameters (in): PortNum - Port of the pins, Mask - Pins driven by the bus
+* Return value: None
+* Description: Copies the levels the bus left on its pins into the Dio output
+*              shadow, so Dio_RefreshOutputs does not restore stale levels.
+************************************************************************************/
+static void Pbus_SyncShadow(Dio_PortType PortNum, uint8 Mask)
+{
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  uint32 Saved;
+  uint8 levels = (uint8)GPIO_HW_READ(GPIO_HW_PORT(PortNum)->DATA[Mask]);
+
+  GPIO_HW_ENTER_CRITICAL(Saved);
+  Dio_OutputShadow[PortNum] = (uint8)((Dio_OutputShadow[PortNum] & ~Mask) | (levels & Mask));
+  GPIO_HW_EXIT_CRITICAL(Saved);
+#else
+  (void)PortNum;
+  (void)Mask;
+#endif
+}
+
+/************************************************************************************
+* Function Name: Pbus_BeginBurst
+* Parameters (in): Cycle - Command or data transfer
+* Return value: None
+* Description: Selects command or data and asserts the chip select.
+************************************************************************************/
+static void Pbus_BeginBurst(Pbus_CycleType Cycle)
+{
+#if (PBUS_DC_CHANNEL == STD_ON)
+  if(Cycle == PBUS_COMMAND)
+  {
+    PBUS_CHANNEL_LOW(DC);
+  }
+  else
+  {
+    PBUS_CHANNEL_HIGH(DC);
+  }
+#else
+  (void)Cycle;
+#endif
+
+#if (PBUS_CS_CHANNEL == STD_ON)
+  PBUS_CHANNEL_LOW(CS);
+#endif
+}
+
+/************************************************************************************
+* Function Name: Pbus_EndBurst
+* Parameters (in): Start - Dio time base value at the start of the burst
+*                  Length - Bytes moved by the burst
+* Return value: None
+* Description: Releases the chip select, syncs the Dio output shadow of the bus
+*              pins and accounts the burst in the throughput totals.
+************************************************************************************/
+static void Pbus_EndBurst(uint32 Start, uint32 Length)
+{
+#if (PBUS_CS_CHANNEL == STD_ON)
+  PBUS_CHANNEL_HIGH(CS);
+#endif
+
+  Pbus_SyncShadow(PbusConf_DATA_PORT_NUM, PbusConf_DATA_MASK);
+#if (PBUS_DC_CHANNEL == STD_ON)
+  Pbus_SyncShadow(PbusConf_DC_PORT_NUM, (uint8)(1U << PbusConf_DC_CHANNEL_NUM));
+#endif
+#if (PBUS_INTERFACE == PBUS_INTERFACE_6800)
+  Pbus_SyncShadow(PbusConf_RD_PORT_NUM, (uint8)(1U << PbusConf_RD_CHANNEL_NUM));
+#endif
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+  Pbus_Ticks += (uint32)((Dio_GetTime() - Start) & 0xFFFFFFFFUL);
+  Pbus_Bytes += Length;
+  if(Pbus_Ticks >= PBUS_THROUGHPUT_TICKS_LIMIT)
+  {
+    Pbus_Ticks >>= 1;
+    Pbus_Bytes >>= 1;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+#else
+  (void)Start;
+  (void)Length;
+#endif
+}
+/********************************************************************************
+ FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Service Name: Pbus_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the bus pins cannot be driven
+* Description: Builds the Port pin sets of the bus, drives the strobes to their
+*              idle level and turns the data and strobe pins into outputs.
+************************************************************************************/
+Std_ReturnType Pbus_Init(void)
+{
+  const Port_PinType DataPins[PBUS_NUMBER_OF_DATA_PINS] = PbusConf_DATA_PINS;
+  const Port_PinType StrobePins[PBUS_NUMBER_OF_STROBE_PINS] = PbusConf_STROBE_PINS;
+
+  if((Port_BuildPinSet(DataPins, PBUS_NUMBER_OF_DATA_PINS, &Pbus_DataPins) != E_OK)
+  || (Port_BuildPinSet(StrobePins, PBUS_NUMBER_OF_STROBE_PINS, &Pbus_StrobePins) != E_OK)
+  || (Pbus_DataPins.DirChangeable == FALSE))
+  {
+    #if (PBUS_DEV_ERROR_DETECT == STD_ON)
+    Det_ReportError(PBUS_MODULE_ID, PBUS_INSTANCE_ID, PBUS_INIT, PBUS_E_PIN_SET);
+    #endif
+    return E_NOT_OK;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+
+  /* Idle levels before the pins are driven, so no strobe glitches */
+#if (PBUS_INTERFACE == PBUS_INTERFACE_8080)
+  PBUS_CHANNEL_HIGH(WR);
+  PBUS_CHANNEL_HIGH(RD);
+#else
+  PBUS_CHANNEL_LOW(WR);
+  PBUS_CHANNEL_LOW(RD);
+#endif
+#if (PBUS_CS_CHANNEL == STD_ON)
+  PBUS_CHANNEL_HIGH(CS);
+#endif
+#if (PBUS_DC_CHANNEL == STD_ON)
+  PBUS_CHANNEL_HIGH(DC);
+#endif
+  GPIO_HW_WRITE(PBUS_DATA_REG, 0);
+
+  Port_SetPinDirectionGroup(&Pbus_StrobePins, PORT_PIN_OUT);
+  Port_SetPinDirectionGroup(&Pbus_DataPins, PORT_PIN_OUT);
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+  /* Dio tells output from input reads by its copy of GPIODIR, it must see the new outputs */
+  Dio_SyncDirections();
+#endif
+
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    uint8 mask = (uint8)(Pbus_DataPins.PinMask[port] | Pbus_StrobePins.PinMask[port]);
+
+    if(mask != 0)
+    {
+      Pbus_SyncShadow(port, mask);
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+  Pbus_Bytes = 0;
+  Pbus_Ticks = 0;
+#endif
+  Pbus_Status = PBUS_INITIALIZED;
+  return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Pbus_Write
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Cycle - Command or data transfer (level of DC)
+*                  Data - Bytes to write
+*                  Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Writes a burst of bytes. Every byte is one masked store of the
+*              data bus and two strobe stores, unrolled by four.
+************************************************************************************/
+void Pbus_Write(Pbus_CycleType Cycle, const uint8 * Data, uint32 Length)
+{
+  uint32 Start = 0;
+  uint32 Remaining = Length;
+
+  #if (PBUS_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Pbus_Status == PBUS_NOT_INITIALIZED)
+  {
+    Det_ReportError(PBUS_MODULE_ID, PBUS_INSTANCE_ID, PBUS_WRITE, PBUS_E_UNINIT);
+    return;
+  }
+  /* check if the input pointer is not a NULL_PTR */
+  else if(Data == NULL_PTR)
+  {
+    Det_ReportError(PBUS_MODULE_ID, PBUS_INSTANCE_ID, PBUS_WRITE, PBUS_E_PARAM_POINTER);
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+  Start = Dio_GetTime();
+#endif
+  Pbus_BeginBurst(Cycle);
+#if (PBUS_INTERFACE == PBUS_INTERFACE_6800)
+  PBUS_CHANNEL_LOW(RD);                 /* R/W low: write */
+#endif
+
+  while(Remaining >= 4U)
+  {
+    PBUS_WRITE_BYTE(Data[0]);
+    PBUS_WRITE_BYTE(Data[1]);
+    PBUS_WRITE_BYTE(Data[2]);
+    PBUS_WRITE_BYTE(Data[3]);
+    Data += 4;
+    Remaining -= 4U;
+  }
+  while(Remaining != 0U)
+  {
+    PBUS_WRITE_BYTE(*Data);
+    Data++;
+    Remaining--;
+  }
+
+  Pbus_EndBurst(Start, Length);
+}
+
+#if (PBUS_READ_API == STD_ON)
+/************************************************************************************
+* Service Name: Pbus_Read
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Cycle - Command or data transfer (level of DC)
+*                  Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): Data - Bytes read
+* Return value: None
+* Description: Reads a burst of bytes, unrolled by four. The data pins are
+*              turned into inputs once for the whole burst.
+************************************************************************************/
+void Pbus_Read(Pbus_CycleType Cycle, uint8 * Data, uint32 Length)
+{
+  uint32 Start = 0;
+  uint32 Remaining = Length;
+
+  #if (PBUS_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Pbus_Status == PBUS_NOT_INITIALIZED)
+  {
+    Det_ReportError(PBUS_MODULE_ID, PBUS_INSTANCE_ID, PBUS_READ, PBUS_E_UNINIT);
+    return;
+  }
+  /* check if the input pointer is not a NULL_PTR */
+  else if(Data == NULL_PTR)
+  {
+    Det_ReportError(PBUS_MODULE_ID, PBUS_INSTANCE_ID, PBUS_READ, PBUS_E_PARAM_POINTER);
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+  Start = Dio_GetTime();
+#endif
+  Port_SetPinDirectionGroup(&Pbus_DataPins, PORT_PIN_IN);
+  Pbus_BeginBurst(Cycle);
+#if (PBUS_INTERFACE == PBUS_INTERFACE_6800)
+  PBUS_CHANNEL_HIGH(RD);                /* R/W high: read */
+#endif
+
+  while(Remaining >= 4U)
+  {
+    PBUS_READ_BYTE(Data[0]);
+    PBUS_READ_BYTE(Data[1]);
+    PBUS_READ_BYTE(Data[2]);
+    PBUS_READ_BYTE(Data[3]);
+    Data += 4;
+    Remaining -= 4U;
+  }
+  while(Remaining != 0U)
+  {
+    PBUS_READ_BYTE(*Data);
+    Data++;
+    Remaining--;
+  }
+
+#if (PBUS_CS_CHANNEL == STD_ON)
+  /* The device stops driving the bus before the pins become outputs again */
+  PBUS_CHANNEL_HIGH(CS);
+#endif
+  Port_SetPinDirectionGroup(&Pbus_DataPins, PORT_PIN_OUT);
+  Pbus_EndBurst(Start, Length);
+}
+#endif
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+/************************************************************************************
+* Service Name: Pbus_GetThroughput
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Reset - TRUE starts a new measurement after the read
+* Parameters (inout): None
+* Parameters (out): Throughput - Bytes, ticks and bytes per second of the bursts
+* Return value: None
+* Description: Reports the throughput achieved by the Pbus_Write and Pbus_Read
+*              bursts. Only the time spent inside the bursts is counted.
+************************************************************************************/
+void Pbus_GetThroughput(Pbus_ThroughputType * Throughput, boolean Reset)
+{
+  #if (PBUS_DEV_ERROR_DETECT == STD_ON)
+  /* check if the input pointer is not a NULL_PTR */
+  if(Throughput == NULL_PTR)
+  {
+    Det_ReportError(PBUS_MODULE_ID, PBUS_INSTANCE_ID, PBUS_GET_THROUGHPUT, PBUS_E_PARAM_POINTER);
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
+
+  Throughput->Bytes = Pbus_Bytes;
+  Throughput->Ticks = Pbus_Ticks;
+  if(Pbus_Ticks != 0)
+  {
+    Throughput->BytesPerSecond = (uint32)(((uint64)Pbus_Bytes * DIO_TICKS_PER_US * 1000000ULL) / Pbus_Ticks);
+  }
+  else
+  {
+    Throughput->BytesPerSecond = 0;
+  }
+
+  if(Reset == TRUE)
+  {
+    Pbus_Bytes = 0;
+    Pbus_Ticks = 0;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+}
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
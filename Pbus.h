@@ -0,0 +1,156 @@
+/**********************************************************************************
+ Module	     : Pbus
+ File Name   : Pbus.h
+ Author	     : Yasser Waleed
+ Description : Header file of the parallel bus driver. Drives 8080 and 6800
+               style peripherals (display controllers, latches) with masked
+               whole-port stores of the data bus and single-store strobes.
+***********************************************************************************/
+#ifndef PBUS_H
+#define PBUS_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "Dio.h"
+#include "Pbus_Cfg.h"
+/**********************************************************************************
+ VERSIONS CHECK
+***********************************************************************************/
+/* Module Version 1.0.0 */
+#define PBUS_SW_MAJOR_VERSION           (1U)
+#define PBUS_SW_MINOR_VERSION           (0U)
+#define PBUS_SW_PATCH_VERSION           (0U)
+
+/* AUTOSAR Version 4.0.3 */
+#define PBUS_AR_RELEASE_MAJOR_VERSION   (4U)
+#define PBUS_AR_RELEASE_MINOR_VERSION   (0U)
+#define PBUS_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Macros for Pbus Status */
+#define PBUS_INITIALIZED                (1U)
+#define PBUS_NOT_INITIALIZED            (0U)
+
+/* AUTOSAR version checking between Pbus_Cfg.h and Pbus.h files */
+#if ((PBUS_CFG_AR_RELEASE_MAJOR_VERSION != PBUS_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PBUS_CFG_AR_RELEASE_MINOR_VERSION != PBUS_AR_RELEASE_MINOR_VERSION)\
+ ||  (PBUS_CFG_AR_RELEASE_PATCH_VERSION != PBUS_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Pbus_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Pbus_Cfg.h and Pbus.h files */
+#if ((PBUS_CFG_SW_MAJOR_VERSION != PBUS_SW_MAJOR_VERSION)\
+ ||  (PBUS_CFG_SW_MINOR_VERSION != PBUS_SW_MINOR_VERSION)\
+ ||  (PBUS_CFG_SW_PATCH_VERSION != PBUS_SW_PATCH_VERSION))
+  #error "The SW version of Pbus_Cfg.h does not match the expected version"
+#endif
+/**********************************************************************************
+ ID MACROS
+***********************************************************************************/
+#define PBUS_VENDOR_ID    (1010U) 	/* ID for the vendor (company) in AUTOSAR, 1010 isn't an actual vendor ID */
+#define PBUS_MODULE_ID    (255U) 		/* Complex Driver Module Id */
+#define PBUS_INSTANCE_ID  (0U) 			/* Pbus Instance Id */
+/******************************************************************************
+ *      API SERVICE ID MACROS                                                 *
+ ******************************************************************************/
+#define PBUS_INIT                   (uint8)0x00
+#define PBUS_WRITE                  (uint8)0x01
+#define PBUS_READ                   (uint8)0x02
+#define PBUS_GET_THROUGHPUT         (uint8)0x03
+/******************************************************************************
+ *      DET ERROR MACROS                                                      *
+ ******************************************************************************/
+#define PBUS_E_UNINIT                    (uint8)0x01 /* API service called without module initialization */
+#define PBUS_E_PARAM_POINTER             (uint8)0x02 /* API called with a NULL Pointer Parameter */
+#define PBUS_E_PIN_SET                   (uint8)0x03 /* Bus pins not configured in Port or not direction changeable */
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+/* Bus interfaces selected by PBUS_INTERFACE */
+#define PBUS_INTERFACE_8080             (0U)            /* Active-low WR and RD strobes */
+#define PBUS_INTERFACE_6800             (1U)            /* Active-high E strobe and R/W level */
+/**********************************************************************************
+ DATA TYPES
+***********************************************************************************/
+/* Level of the DC channel during a transfer */
+typedef enum
+{
+  PBUS_COMMAND,                         /* DC low */
+  PBUS_DATA                             /* DC high */
+} Pbus_CycleType;
+
+/* Measured bus throughput, the totals are kept since Pbus_Init or the last reset */
+typedef struct
+{
+  uint32 Bytes;                         /* Bytes moved by the measured transfers */
+  uint32 Ticks;                         /* Dio time base ticks spent in those transfers */
+  uint32 BytesPerSecond;                /* Bytes / Ticks scaled to one second */
+} Pbus_ThroughputType;
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+/*******************************************************************************
+* Service Name: Pbus_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the bus pins cannot be driven
+* Description: Builds the Port pin sets of the bus, drives the strobes to their
+*              idle level and turns the data and strobe pins into outputs.
+*              Port_Init and Dio_Init must have been called.
+********************************************************************************/
+Std_ReturnType Pbus_Init(void);
+
+/*******************************************************************************
+* Service Name: Pbus_Write
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Cycle - Command or data transfer (level of DC)
+*                  Data - Bytes to write
+*                  Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Writes a burst of bytes with chip select held for the whole burst.
+********************************************************************************/
+void Pbus_Write(Pbus_CycleType Cycle, const uint8 * Data, uint32 Length);
+
+#if (PBUS_READ_API == STD_ON)
+/*******************************************************************************
+* Service Name: Pbus_Read
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Cycle - Command or data transfer (level of DC)
+*                  Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): Data - Bytes read
+* Return value: None
+* Description: Reads a burst of bytes, the data pins are inputs for the burst only.
+********************************************************************************/
+void Pbus_Read(Pbus_CycleType Cycle, uint8 * Data, uint32 Length);
+#endif
+
+#if (PBUS_THROUGHPUT_API == STD_ON)
+/*******************************************************************************
+* Service Name: Pbus_GetThroughput
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Reset - TRUE starts a new measurement after the read
+* Parameters (inout): None
+* Parameters (out): Throughput - Bytes, ticks and bytes per second of the bursts
+* Return value: None
+* Description: Reports the throughput achieved by the Pbus_Write and Pbus_Read
+*              bursts, measured on the Dio time base.
+********************************************************************************/
+void Pbus_GetThroughput(Pbus_ThroughputType * Throughput, boolean Reset);
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
@@ -0,0 +1,61 @@
+/**********************************************************************************
+ Module		: Pbus
+ File Name	: Pbus_Cfg.h
+ Author		: Yasser Waleed
+ Description    : Header file containing the parallel bus configurations: bus
+		  interface, data port and mask, strobe channels and the Port
+		  pins of the bus.
+***********************************************************************************/
+#ifndef PBUS_CFG_H
+#define PBUS_CFG_H
+/**********************************************************************************
+ VERSIONS CHECK
+***********************************************************************************/
+/* Module Version 1.0.0 */
+#define PBUS_CFG_SW_MAJOR_VERSION                      (1U)
+#define PBUS_CFG_SW_MINOR_VERSION                      (0U)
+#define PBUS_CFG_SW_PATCH_VERSION                      (0U)
+
+/* AUTOSAR Version 4.0.3 */
+#define PBUS_CFG_AR_RELEASE_MAJOR_VERSION              (4U)
+#define PBUS_CFG_AR_RELEASE_MINOR_VERSION              (0U)
+#define PBUS_CFG_AR_RELEASE_PATCH_VERSION              (3U)
+/**********************************************************************************
+ CONFIGURATIONS
+***********************************************************************************/
+#define PBUS_DEV_ERROR_DETECT           (STD_ON)        /* Enable/Disable Development Error Detection */
+
+#define PBUS_READ_API                   (STD_ON)        /* Enable/Disable Pbus_Read API */
+
+#define PBUS_THROUGHPUT_API             (STD_ON)        /* Enable/Disable the bytes per second measurement on the Dio time base */
+
+#define PBUS_INTERFACE                  PBUS_INTERFACE_8080 /* PBUS_INTERFACE_8080 or PBUS_INTERFACE_6800 */
+
+#define PBUS_READ_SETTLE_READS          (1U)            /* GPIODATA reads discarded after the read strobe (device access time) */
+
+#define PBUS_CS_CHANNEL                 (STD_ON)        /* The bus has a chip select, asserted for every transfer */
+
+#define PBUS_DC_CHANNEL                 (STD_ON)        /* The bus has a data/command select (low for commands) */
+
+/* Data bus: Dio port, pins of the port and position of the bus LSB */
+#define PbusConf_DATA_PORT_NUM          DioConf_PORTB_PORT_NUM  /* PB0..PB7 */
+#define PbusConf_DATA_MASK              (uint8)0xFF
+#define PbusConf_DATA_OFFSET            (uint8)0
+
+/* Strobe channels: 8080 uses WR and RD (active low), 6800 uses WR as E (active high) and RD as R/W */
+#define PbusConf_WR_PORT_NUM            DioConf_PORTE_PORT_NUM
+#define PbusConf_WR_CHANNEL_NUM         (Dio_ChannelType)1 /* PE1 */
+#define PbusConf_RD_PORT_NUM            DioConf_PORTE_PORT_NUM
+#define PbusConf_RD_CHANNEL_NUM         (Dio_ChannelType)2 /* PE2 */
+#define PbusConf_CS_PORT_NUM            DioConf_PORTE_PORT_NUM
+#define PbusConf_CS_CHANNEL_NUM         (Dio_ChannelType)3 /* PE3 */
+#define PbusConf_DC_PORT_NUM            DioConf_PORTE_PORT_NUM
+#define PbusConf_DC_CHANNEL_NUM         (Dio_ChannelType)4 /* PE4 */
+
+/* Port Pin IDs (index in Port_PBcfg.c) of the data pins and of the strobe pins */
+#define PBUS_NUMBER_OF_DATA_PINS        (8U)
+#define PbusConf_DATA_PINS              { 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U }  /* PB0..PB7 */
+#define PBUS_NUMBER_OF_STROBE_PINS      (4U)
+#define PbusConf_STROBE_PINS            { 29U, 30U, 31U, 32U }                    /* PE1..PE4 */
+
+#endif /* PBUS_CFG_H */
@@ -8,7 +8,7 @@
  INCLUDES
 *********************************************************************************/
 #include "Port.h"
-#include "tm4c123gh6pm_registers.h"
+#include "Gpio_Hw.h"
 /********************************************************************************
  DEVELOPMENT ERRORS DETECTION
 *********************************************************************************/
@@ -22,12 +22,422 @@
   #error "The AR version of Det.h does not match the expected version"
 #endif
 
+#endif
+/********************************************************************************
+ LOCAL MACROS
+*********************************************************************************/
+#if (PORT_BIT_BAND_ACCESS == STD_ON)
+/* Single-pin updates are one atomic store to the bit-band alias of the register bit */
+#define PORT_SET_REG_BIT(REG,BIT)       GPIO_HW_BITBAND_WRITE(REG, BIT, 1U)
+#define PORT_CLEAR_REG_BIT(REG,BIT)     GPIO_HW_BITBAND_WRITE(REG, BIT, 0U)
+#else
+#define PORT_SET_REG_BIT(REG,BIT)       GPIO_HW_SET_BITS(REG, 1UL << (BIT))
+#define PORT_CLEAR_REG_BIT(REG,BIT)     GPIO_HW_CLEAR_BITS(REG, 1UL << (BIT))
 #endif
 /********************************************************************************
  LOCAL VARIABLES
 *********************************************************************************/
 static uint8 Port_Status = PORT_NOT_INITIALIZED;
 static const Port_ConfigType* Port_ConfigPtr = NULL_PTR;
+
+/* Direction-unchangeable pins of every port and the GPIODIR value they must keep */
+static uint8 Port_FixedDirMask  [ PORT_NUMBER_OF_PORTS ];
+static uint8 Port_FixedDirValue [ PORT_NUMBER_OF_PORTS ];
+
+/* Pins owned by the applied configuration set and the locked ones among them, used by the context services */
+static uint8 Port_PinMask    [ PORT_NUMBER_OF_PORTS ];
+static uint8 Port_CommitMask [ PORT_NUMBER_OF_PORTS ];
+
+/* Pins restored by Port_RefreshPortDirection since Port_Init */
+static uint32 Port_DirectionDriftCount = 0;
+
+static const Port_DirectionDriftNotificationType Port_DirectionDriftNotification = PORT_DIRECTION_DRIFT_NOTIFICATION;
+/********************************************************************************
+ LOCAL FUNCTIONS
+*********************************************************************************/
+#if (PORT_PRECOMPILED_IMAGE == STD_OFF)
+/************************************************************************************
+* Function Name: Port_FoldPinDrive
+* Parameters (in): Pin - Packed descriptor of a digital pin, PinBit - Bit of the pin in its port
+* Parameters (inout): Image - Register image of the port of the pin
+* Return value: None
+* Description: Adds the drive strength, slew rate and open-drain bits of the pin.
+************************************************************************************/
+static void Port_FoldPinDrive(Port_PortImageType* Image, Port_ConfigPins Pin, uint8 PinBit)
+{
+  if(PORT_CFG_GET_DRIVE(Pin) == PORT_PIN_DRIVE_8MA)
+  {
+    Image->Dr8r |= PinBit;
+  }
+  else if(PORT_CFG_GET_DRIVE(Pin) == PORT_PIN_DRIVE_4MA)
+  {
+    Image->Dr4r |= PinBit;
+  }
+  else
+  {
+    Image->Dr2r |= PinBit;
+  }
+
+  if(PORT_CFG_GET_SLEW(Pin) == PORT_PIN_SLEW_CONTROL_ON)
+  {
+    Image->Slr |= PinBit;
+  }
+  else
+  {
+    /* Do Nothing ... fast edges */
+  }
+
+  if(PORT_CFG_GET_OUTPUT_TYPE(Pin) == PORT_PIN_OPEN_DRAIN)
+  {
+    Image->Odr |= PinBit;
+  }
+  else
+  {
+    /* Do Nothing ... push-pull output */
+  }
+}
+
+/************************************************************************************
+* Function Name: Port_BuildPortImages
+* Parameters (in): ConfigPtr - Pointer to configuration set
+* Parameters (out): Images - Per-port register images (PORT_NUMBER_OF_PORTS entries)
+* Return value: None
+* Description: Folds the pin table into one register image per port, so that every
+*              GPIO register is written only once per port by Port_Init.
+************************************************************************************/
+static void Port_BuildPortImages(const Port_ConfigType* ConfigPtr, Port_PortImageType* Images)
+{
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    Images[port].PinMask    = 0;
+    Images[port].CommitMask = 0;
+    Images[port].Dir        = 0;
+    Images[port].DirFixed   = 0;
+    Images[port].Den        = 0;
+    Images[port].Amsel      = 0;
+    Images[port].Afsel      = 0;
+    Images[port].Pur        = 0;
+    Images[port].Pdr        = 0;
+    Images[port].Data       = 0;
+    Images[port].Dr2r       = 0;
+    Images[port].Dr4r       = 0;
+    Images[port].Dr8r       = 0;
+    Images[port].Odr        = 0;
+    Images[port].Slr        = 0;
+    Images[port].Pctl       = 0;
+  }
+
+  for (Port_PinType index = 0; index < PORT_NUMBER_OF_PORT_PINS; index++)
+  {
+    Port_ConfigPins Pin = ConfigPtr->PortPins[index];
+    uint8 PinNum = PORT_CFG_GET_PIN(Pin);
+    Port_PortImageType * Image = &Images[PORT_CFG_GET_PORT(Pin)];
+    uint8 PinBit = (uint8)(1U << PinNum);
+
+    Image->PinMask |= PinBit;
+
+    if(PORT_CFG_GET_DIR_CHANGEABLE(Pin) == DIR_NOT_CHANGEABLE)
+    {
+      Image->DirFixed |= PinBit;
+    }
+    else
+    {
+      /* Do Nothing ... direction may be changed at run time */
+    }
+
+    if(((PORT_CFG_GET_PORT(Pin) == PORT_PORT_D) && (PinNum == PORT_PIN_7))\
+    || ((PORT_CFG_GET_PORT(Pin) == PORT_PORT_F) && (PinNum == PORT_PIN_0))) /* PD7 or PF0 */
+    {
+      Image->CommitMask |= PinBit;
+    }
+    else
+    {
+      /* Do Nothing ... No need to unlock the commit register for this pin */
+    }
+
+    if (PORT_CFG_GET_MODE(Pin) == PORT_PIN_MODE_DIO)
+    {
+      /* Digital function only: no analog, no alternative function, PMCx left cleared */
+      Image->Den |= PinBit;
+    }
+    else if (PORT_CFG_GET_MODE(Pin) == PORT_PIN_MODE_ADC)
+    {
+      /* Analog function only: digital and alternative functions left disabled */
+      Image->Amsel |= PinBit;
+    }
+    else /* Another mode */
+    {
+      /* Alternative function selected by the PMCx bits of this pin */
+      Image->Afsel |= PinBit;
+      Image->Pctl  |= ((uint32)PORT_CFG_GET_MODE(Pin) & 0x0000000F) << (PinNum * 4);
+      Image->Den   |= PinBit;
+    }
+
+    if (PORT_CFG_GET_MODE(Pin) == PORT_PIN_MODE_ADC)
+    {
+      /* No digital output, keep the 2 mA reset drive */
+      Image->Dr2r |= PinBit;
+    }
+    else
+    {
+      Port_FoldPinDrive(Image, Pin, PinBit);
+    }
+
+    if(PORT_CFG_GET_DIRECTION(Pin) == PORT_PIN_OUT)
+    {
+      Image->Dir |= PinBit;
+
+      if(PORT_CFG_GET_LEVEL(Pin) == HIGH)
+      {
+        Image->Data |= PinBit;
+      }
+      else
+      {
+        /* Do Nothing ... initial value 0 */
+      }
+    }
+    else
+    {
+      if(PORT_CFG_GET_RESISTOR(Pin) == PULL_UP)
+      {
+        Image->Pur |= PinBit;
+      }
+      else if(PORT_CFG_GET_RESISTOR(Pin) == PULL_DOWN)
+      {
+        Image->Pdr |= PinBit;
+      }
+      else
+      {
+        /* Do Nothing ... internal resistors left disabled */
+      }
+    }
+  }
+}
+
+#endif
+
+/************************************************************************************
+* Function Name: Port_PctlMask
+* Parameters (in): PinMask - 8-bit mask of port pins
+* Return value: uint32 - Mask covering the PMCx fields of the given pins
+* Description: Expands a pin mask into the matching GPIOPCTL nibble mask.
+************************************************************************************/
+static uint32 Port_PctlMask(uint8 PinMask)
+{
+  uint32 mask = 0;
+
+  for (uint8 pin = 0; pin < 8; pin++)
+  {
+    if(BIT_IS_SET(PinMask, pin))
+    {
+      mask |= 0x0000000F << (pin * 4);
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+  return mask;
+}
+
+/************************************************************************************
+* Function Name: Port_EnablePortClocks
+* Parameters (in): PortMask - Ports with at least one configured pin
+* Return value: None
+* Description: Enables the clock of all the configured ports in one write and waits
+*              until GPIO peripheral ready reports every one of them as accessible.
+************************************************************************************/
+static void Port_EnablePortClocks(uint8 PortMask)
+{
+#if (PORT_GATE_UNUSED_PORTS == STD_ON)
+  /* Ports without configured pins are left unclocked */
+  GPIO_HW_WRITE(GPIO_HW_RCGCGPIO_REG, PortMask);
+#else
+  GPIO_HW_SET_BITS(GPIO_HW_RCGCGPIO_REG, PortMask);
+#endif
+
+  while((GPIO_HW_READ(GPIO_HW_PRGPIO_REG) & PortMask) != PortMask)
+  {
+    /* Wait until the ports are ready */
+  }
+}
+
+/************************************************************************************
+* Function Name: Port_WritePinDrive
+* Parameters (in): Regs - Register block of the port
+*                  PinCfg - Packed descriptor of the pin
+* Return value: None
+* Description: Writes the drive strength, slew rate and open-drain bits of one pin.
+************************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+static void Port_WritePinDrive(Gpio_RegsType * Regs, Port_ConfigPins PinCfg)
+{
+  uint8 PinNum = PORT_CFG_GET_PIN(PinCfg);
+
+  /* Setting the bit in one drive register clears it in the two others */
+  if(PORT_CFG_GET_DRIVE(PinCfg) == PORT_PIN_DRIVE_8MA)
+  {
+    PORT_SET_REG_BIT(Regs->DR8R, PinNum);
+  }
+  else if(PORT_CFG_GET_DRIVE(PinCfg) == PORT_PIN_DRIVE_4MA)
+  {
+    PORT_SET_REG_BIT(Regs->DR4R, PinNum);
+  }
+  else
+  {
+    PORT_SET_REG_BIT(Regs->DR2R, PinNum);
+  }
+
+  if(PORT_CFG_GET_SLEW(PinCfg) == PORT_PIN_SLEW_CONTROL_ON)
+  {
+    PORT_SET_REG_BIT(Regs->SLR, PinNum);
+  }
+  else
+  {
+    PORT_CLEAR_REG_BIT(Regs->SLR, PinNum);
+  }
+
+  if(PORT_CFG_GET_OUTPUT_TYPE(PinCfg) == PORT_PIN_OPEN_DRAIN)
+  {
+    PORT_SET_REG_BIT(Regs->ODR, PinNum);
+  }
+  else
+  {
+    PORT_CLEAR_REG_BIT(Regs->ODR, PinNum);
+  }
+}
+#endif
+
+/************************************************************************************
+* Function Name: Port_UnlockPort
+* Parameters (in): Regs - Register block of the port
+*                  CommitMask - Locked pins to allow changes on
+* Return value: None
+* Description: Unlocks GPIOCR and commits the given locked pins (PD7/PF0).
+************************************************************************************/
+static void Port_UnlockPort(Gpio_RegsType * Regs, uint8 CommitMask)
+{
+  GPIO_HW_WRITE(Regs->LOCK, GPIO_HW_UNLOCK_KEY);       /* Unlock the GPIOCR register */
+  GPIO_HW_SET_BITS(Regs->CR, CommitMask);               /* Allow changes on the locked pins */
+}
+
+/************************************************************************************
+* Function Name: Port_WritePortImage
+* Parameters (in): Regs - Register block of the port
+*                  Image - Register image of this port
+* Return value: None
+* Description: Writes every GPIO register of the port once, touching only the
+*              pins owned by the image. Locked pins must be unlocked beforehand.
+************************************************************************************/
+static void Port_WritePortImage(Gpio_RegsType * Regs, const Port_PortImageType* Image)
+{
+  uint32 mask     = Image->PinMask;
+  uint32 pctlMask = Port_PctlMask(Image->PinMask);
+
+  GPIO_HW_MERGE_BITS(Regs->AMSEL, mask,     Image->Amsel);
+  GPIO_HW_MERGE_BITS(Regs->AFSEL, mask,     Image->Afsel);
+  GPIO_HW_MERGE_BITS(Regs->PCTL,  pctlMask, Image->Pctl);
+
+  /* Setting a drive strength bit clears the pin in the two other drive registers */
+  GPIO_HW_MERGE_BITS(Regs->DR2R,  mask,     Image->Dr2r);
+  GPIO_HW_MERGE_BITS(Regs->DR4R,  mask,     Image->Dr4r);
+  GPIO_HW_MERGE_BITS(Regs->DR8R,  mask,     Image->Dr8r);
+  GPIO_HW_MERGE_BITS(Regs->ODR,   mask,     Image->Odr);
+  GPIO_HW_MERGE_BITS(Regs->SLR,   mask,     Image->Slr);
+  GPIO_HW_MERGE_BITS(Regs->DEN,   mask,     Image->Den);
+  GPIO_HW_MERGE_BITS(Regs->PUR,   mask,     Image->Pur);
+  GPIO_HW_MERGE_BITS(Regs->PDR,   mask,     Image->Pdr);
+
+  /* Provide the initial output levels before the pins are turned into outputs, the
+     masked GPIODATA word only reaches the owned pins so no read is needed */
+  GPIO_HW_WRITE(Regs->DATA[mask], Image->Data);
+  GPIO_HW_MERGE_BITS(Regs->DIR,   mask,     Image->Dir);
+}
+
+/************************************************************************************
+* Function Name: Port_StorePortMasks
+* Parameters (in): Images - Register images of the applied configuration set
+* Return value: None
+* Description: Keeps the owned and locked pins of every port for the context
+*              services, and the direction-unchangeable pins with their GPIODIR
+*              value for Port_RefreshPortDirection.
+************************************************************************************/
+static void Port_StorePortMasks(const Port_PortImageType* Images)
+{
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    Port_PinMask[port]       = Images[port].PinMask;
+    Port_CommitMask[port]    = Images[port].CommitMask;
+    Port_FixedDirMask[port]  = Images[port].DirFixed;
+    Port_FixedDirValue[port] = Images[port].Dir & Images[port].DirFixed;
+  }
+}
+
+#if (PORT_SWITCH_CONFIG_API == STD_ON)
+/************************************************************************************
+* Function Name: Port_WriteRegBits
+* Parameters (in): Reg - Register to update
+*                  Mask - Bits to write, nothing is written when no bit is set
+*                  Value - New value of those bits
+* Return value: None
+* Description: Writes the masked bits of one register of a configuration switch.
+************************************************************************************/
+static void Port_WriteRegBits(volatile uint32 * Reg, uint32 Mask, uint32 Value)
+{
+  if(Mask != 0)
+  {
+    GPIO_HW_MERGE_BITS(*Reg, Mask, Value & Mask);
+  }
+  else
+  {
+    /* Do Nothing ... register identical in both configuration sets */
+  }
+}
+#endif
+
+#if ((PORT_SWITCH_CONFIG_API == STD_ON) && (PORT_PRECOMPILED_IMAGE == STD_OFF))
+/************************************************************************************
+* Function Name: Port_WritePortDelta
+* Parameters (in): Regs - Register block of the port
+*                  From - Register image of the applied configuration set
+*                  To - Register image of the configuration set to apply
+* Return value: None
+* Description: Writes only the bits that differ between the two images, in the
+*              register order of Port_WritePortImage.
+************************************************************************************/
+static void Port_WritePortDelta(Gpio_RegsType * Regs, const Port_PortImageType* From, const Port_PortImageType* To)
+{
+  Port_WriteRegBits(&Regs->AMSEL, From->Amsel ^ To->Amsel, To->Amsel);
+  Port_WriteRegBits(&Regs->AFSEL, From->Afsel ^ To->Afsel, To->Afsel);
+  Port_WriteRegBits(&Regs->PCTL,  From->Pctl  ^ To->Pctl,  To->Pctl);
+  Port_WriteRegBits(&Regs->DR2R,  From->Dr2r  ^ To->Dr2r,  To->Dr2r);
+  Port_WriteRegBits(&Regs->DR4R,  From->Dr4r  ^ To->Dr4r,  To->Dr4r);
+  Port_WriteRegBits(&Regs->DR8R,  From->Dr8r  ^ To->Dr8r,  To->Dr8r);
+  Port_WriteRegBits(&Regs->ODR,   From->Odr   ^ To->Odr,   To->Odr);
+  Port_WriteRegBits(&Regs->SLR,   From->Slr   ^ To->Slr,   To->Slr);
+  Port_WriteRegBits(&Regs->DEN,   From->Den   ^ To->Den,   To->Den);
+  Port_WriteRegBits(&Regs->PUR,   From->Pur   ^ To->Pur,   To->Pur);
+  Port_WriteRegBits(&Regs->PDR,   From->Pdr   ^ To->Pdr,   To->Pdr);
+  Port_WriteRegBits(&Regs->DATA[GPIO_HW_DATA_ALL_PINS], From->Data ^ To->Data, To->Data);
+  Port_WriteRegBits(&Regs->DIR,   From->Dir   ^ To->Dir,   To->Dir);
+}
+
+/************************************************************************************
+* Function Name: Port_PortDeltaBits
+* Parameters (in): From - Image of the port in the set applied, To - Image in the set to apply
+* Return value: uint32 - Non zero when Port_WritePortDelta writes a register of the port
+* Description: Tells the ports a configuration switch accesses.
+************************************************************************************/
+static uint32 Port_PortDeltaBits(const Port_PortImageType* From, const Port_PortImageType* To)
+{
+  return (uint32)((From->Amsel ^ To->Amsel) | (From->Afsel ^ To->Afsel) | (From->Dr2r ^ To->Dr2r) |
+                  (From->Dr4r ^ To->Dr4r) | (From->Dr8r ^ To->Dr8r) | (From->Odr ^ To->Odr) |
+                  (From->Slr ^ To->Slr) | (From->Den ^ To->Den) | (From->Pur ^ To->Pur) |
+                  (From->Pdr ^ To->Pdr) | (From->Data ^ To->Data) | (From->Dir ^ To->Dir)) |
+         (From->Pctl ^ To->Pctl);
+}
+#endif
+
 /************************************************************************************
 * Service Name: Port_Init
 * Service ID[hex]: 0x00
@@ -46,452 +456,1049 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
   if(ConfigPtr == NULL_PTR)
   {
     Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT, PORT_E_PARAM_CONFIG);
+    return;
+  }
+  /* check if the configuration set ID is valid */
+  else if(ConfigPtr->ConfigSetId >= PORT_NUMBER_OF_CONFIG_SETS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT, PORT_E_PARAM_CONFIG);
+    return;
   }
   else
   {	/* Do Nothing */	}
   #endif
 
-  Port_Status = PORT_INITIALIZED;
+#if (PORT_AHB_APERTURE == STD_ON)
+  /* Move every port to the AHB aperture before any of its registers is accessed */
+  GPIO_HW_SET_BITS(GPIO_HW_HBCTL_REG, GPIO_HW_ALL_PORTS_MASK);
+#endif
+
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+  /* The register images were generated offline from the pin table, no per-pin decoding is needed */
+  const Port_ImageSetType*  ImageSet = &Port_PrecompiledImages[ConfigPtr->ConfigSetId];
+  const Port_PortImageType* Images   = ImageSet->Ports;
+
+  Port_EnablePortClocks(ImageSet->ClockMask);
+
+  for (uint8 entry = 0; entry < ImageSet->UnlockCount; entry++)
+  {
+    Port_UnlockPort(GPIO_HW_PORT(ImageSet->Unlock[entry].PortNum), ImageSet->Unlock[entry].CommitMask);
+  }
+#else
+  Port_PortImageType Images[PORT_NUMBER_OF_PORTS];
+  uint32 PortClocks = 0;
+
+  Port_BuildPortImages(ConfigPtr, Images);
+
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    if(Images[port].PinMask != 0)
+    {
+      PortClocks |= (1UL << port);
+    }
+    else
+    {
+      /* Do Nothing ... no pins configured on this port */
+    }
+  }
+
+  Port_EnablePortClocks(PortClocks);
+
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    if(Images[port].CommitMask != 0)
+    {
+      Port_UnlockPort(GPIO_HW_PORT(port), Images[port].CommitMask);
+    }
+    else
+    {
+      /* Do Nothing ... No need to unlock the commit register for this port */
+    }
+  }
+#endif
+
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    if(Images[port].PinMask != 0)
+    {
+      Port_WritePortImage(GPIO_HW_PORT(port), &Images[port]);
+    }
+    else
+    {
+      /* Do Nothing ... no pins configured on this port */
+    }
+  }
+
+  Port_StorePortMasks(Images);
+  Port_DirectionDriftCount = 0;
   Port_ConfigPtr = ConfigPtr;
-  for (Port_PinType index = 0; index < PORT_NUMBER_OF_PORT_PINS; index++)
+  Port_Status = PORT_INITIALIZED;
+}
+
+
+/************************************************************************************
+* Service Name: Port_SetPinDirection
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Pin - Port Pin ID number , Direction - Port Pin Direction
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Sets the port pin direction.
+************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+{
+  boolean error = FALSE;
+
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    volatile uint32 delay = 0;
-    
-    switch(ConfigPtr->PortPins[index].PortNum)
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if incorrect Port Pin ID passed */
+  else if(Pin >= PORT_NUMBER_OF_PORT_PINS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION, PORT_E_PARAM_PIN);
+    error = TRUE;
+  }
+  /* check if Port Pin not configured as changeable */
+  else if(PORT_CFG_GET_DIR_CHANGEABLE(Port_ConfigPtr->PortPins[Pin]) == DIR_NOT_CHANGEABLE)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION, PORT_E_DIRECTION_UNCHANGEABLE);
+    error = TRUE;
+  }
+  else
+  {	
+    /* Do Nothing */	
+  }
+  #endif
+
+  if(FALSE == error)
+  {
+    Port_ConfigPins PinCfg = Port_ConfigPtr->PortPins[Pin];
+    Gpio_RegsType * Regs = GPIO_HW_PORT(PORT_CFG_GET_PORT(PinCfg));
+
+    if(Direction == PORT_PIN_OUT)
     {
-      case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; break;
-      case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; break;
-      case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; break;
-      case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; break;
-      case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; break;
-      case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; break;
+      /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+      PORT_SET_REG_BIT(Regs->DIR, PORT_CFG_GET_PIN(PinCfg));
     }
-    
-    /* Enable clock for PORT and allow time for clock to start*/
-    SYSCTL_REGCGC2_REG |= (1<<Port_ConfigPtr->PortPins[index].PortNum);
-    delay = SYSCTL_REGCGC2_REG;
-    
-    if(((Port_ConfigPtr->PortPins[index].PortNum == 3) && (Port_ConfigPtr->PortPins[index].PinNum == 7))\
-    || ((Port_ConfigPtr->PortPins[index].PortNum == 5) && (Port_ConfigPtr->PortPins[index].PinNum == 0))) /* PD7 or PF0 */
+    else
     {
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;                               /* Unlock the GPIOCR register */   
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , ConfigPtr->PortPins[index].PinNum);  /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
+      /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+      PORT_CLEAR_REG_BIT(Regs->DIR, PORT_CFG_GET_PIN(PinCfg));
     }
-		
-    else if((Port_ConfigPtr->PortPins[index].PortNum == 2) && (Port_ConfigPtr->PortPins[index].PinNum <= 3)) /* PC0 to PC3 */
+  }
+  else
+  {	
+    /* Do Nothing */	
+  }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_RefreshPortDirection
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Refreshes port direction.
+************************************************************************************/
+void Port_RefreshPortDirection(void)
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESH_PORT_DIRECTION, PORT_E_UNINIT);
+    return;
+  }
+  else
+  {	
+    /* Do Nothing */	
+  }
+  #endif
+  
+  /* PORT061: The function Port_RefreshPortDirection shall exclude those port pins from
+    refreshing that are configured as "pin direction changeable during runtime".
+    The unchangeable pins were folded per port by Port_Init, so every port costs one
+    GPIODIR read and is only written back when one of its pins has drifted. Ports
+    whose clock is gated (Port_GatePortClocks) are skipped, like Dio does, since an
+    access to a port that is not ready in PRGPIO faults. */
+  uint32 ReadyMask = GPIO_HW_READ(GPIO_HW_PRGPIO_REG);
+
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    if((Port_FixedDirMask[port] != 0) && BIT_IS_SET(ReadyMask, port))
     {
-      /* Do Nothing ...  this is a JTAG pin */
+      Gpio_RegsType * Regs = GPIO_HW_PORT(port);
+      uint32 Dir = GPIO_HW_READ(Regs->DIR);
+      uint8 DriftMask = (uint8)((Dir ^ Port_FixedDirValue[port]) & Port_FixedDirMask[port]);
+
+      if(DriftMask != 0)
+      {
+        /* Flip back the drifted pins only */
+        GPIO_HW_WRITE(Regs->DIR, Dir ^ DriftMask);
+
+        for (uint8 pin = 0; pin < 8; pin++)
+        {
+          if(BIT_IS_SET(DriftMask, pin))
+          {
+            Port_DirectionDriftCount++;
+          }
+          else
+          {
+            /* Do Nothing */
+          }
+        }
+
+        if(Port_DirectionDriftNotification != NULL_PTR)
+        {
+          Port_DirectionDriftNotification((Port_PortNumType)port, DriftMask);
+        }
+        else
+        {
+          /* Do Nothing */
+        }
+      }
+      else
+      {
+        /* Do Nothing ... no drift on this port */
+      }
     }
-		
     else
     {
-      /* Do Nothing ... No need to unlock the commit register for this pin */
+      /* Do Nothing ... no direction-unchangeable pins on this port, or port not clocked */
     }
-    
-    if (Port_ConfigPtr->PortPins[index].PinInitMode == PORT_PIN_MODE_DIO)
+  }
+}
+
+/************************************************************************************
+* Service Name: Port_GetDirectionDriftCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of pins restored by Port_RefreshPortDirection
+* Description: Returns how many pin directions were found drifted since Port_Init.
+************************************************************************************/
+uint32 Port_GetDirectionDriftCount(void)
+{
+  return Port_DirectionDriftCount;
+}
+
+/************************************************************************************
+* Service Name: Port_GetVersionInfo
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Returns the version information of this module.
+************************************************************************************/
+#if (PORT_VERSION_INFO_API == STD_ON)
+void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* check if the input configuration pointer is not a NULL_PTR */
+  if(versioninfo == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO, PORT_E_PARAM_POINTER);
+    return;
+  }
+  else
+  {
+    /* Do Nothing */	
+  }
+  #endif
+
+  /* Copy the module Id */
+  versioninfo->moduleID = (uint16)PORT_MODULE_ID;
+  /* Copy the vendor Id */
+  versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
+  /* Copy Software Major Version */
+  versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
+  /* Copy Software Minor Version */
+  versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
+  /* Copy Software Patch Version */
+  versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_SetPinMode
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Pin - Port Pin ID number, Mode - New Port Pin mode to be set on port pin
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the port pin mode.
+************************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+{
+  boolean error = FALSE;
+
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if incorrect Port Pin ID passed */
+  else if(Pin >= PORT_NUMBER_OF_PORT_PINS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_PARAM_PIN);
+    error = TRUE;
+  }
+  /* check if the Port Pin Mode passed not valid */
+  else if(Mode > PORT_PIN_MODE_DIO)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_PARAM_INVALID_MODE);
+    error = TRUE;
+  }
+  /* check if the API called when the mode is unchangeable */
+  else if(PORT_CFG_GET_MODE_CHANGEABLE(Port_ConfigPtr->PortPins[Pin]) == MODE_NOT_CHANGEABLE)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_MODE_UNCHANGEABLE);
+    error = TRUE;
+  }
+  else
+  {	
+    /* Do Nothing */	
+  }
+  #endif
+
+  if(FALSE == error)
+  {
+    Port_ConfigPins PinCfg = Port_ConfigPtr->PortPins[Pin];
+    Gpio_RegsType * Regs = GPIO_HW_PORT(PORT_CFG_GET_PORT(PinCfg));
+    uint8 PinNum = PORT_CFG_GET_PIN(PinCfg);
+
+    if (Mode == PORT_PIN_MODE_DIO)
     {
       /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_CLEAR_REG_BIT(Regs->AMSEL, PinNum);
 
       /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_CLEAR_REG_BIT(Regs->AFSEL, PinNum);
 
       /* Clear the PMCx bits for this pin */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->PortPins[index].PinNum * 4));
+      GPIO_HW_CLEAR_BITS(Regs->PCTL, 0x0000000FUL << (PinNum * 4));
+
+      /* Apply the configured drive strength, slew rate and output type of this pin */
+      Port_WritePinDrive(Regs, PinCfg);
 
       /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_SET_REG_BIT(Regs->DEN, PinNum);
     }
-    
-    else if (Port_ConfigPtr->PortPins[index].PinInitMode == PORT_PIN_MODE_ADC)
+    else if (Mode == PORT_PIN_MODE_ADC)
     {
       /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_CLEAR_REG_BIT(Regs->DEN, PinNum);
 
       /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_CLEAR_REG_BIT(Regs->AFSEL, PinNum);
 
       /* Clear the PMCx bits for this pin */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->PortPins[index].PinNum * 4));
+      GPIO_HW_CLEAR_BITS(Regs->PCTL, 0x0000000FUL << (PinNum * 4));
 
       /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_SET_REG_BIT(Regs->AMSEL, PinNum);
     }
-    
     else /* Another mode */
     {
       /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      PORT_CLEAR_REG_BIT(Regs->AMSEL, PinNum);
 
-      /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      /* Enable Alternative function for this pin by set the corresponding bit in GPIOAFSEL register */
+      PORT_SET_REG_BIT(Regs->AFSEL, PinNum);
 
       /* Set the PMCx bits for this pin */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Port_ConfigPtr->PortPins[index].PinInitMode & 0x0000000F << (Port_ConfigPtr->PortPins[index].PinNum * 4));
+      GPIO_HW_MERGE_BITS(Regs->PCTL, 0x0000000FUL << (PinNum * 4), ((uint32)Mode & 0x0000000F) << (PinNum * 4));
+
+      /* Apply the configured drive strength, slew rate and output type of this pin */
+      Port_WritePinDrive(Regs, PinCfg);
+
+      /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+      PORT_SET_REG_BIT(Regs->DEN, PinNum);
+    }
+  }
+  else
+  {	
+    /* Do Nothing */	
+  }
+}
+#endif
+/************************************************************************************
+* Service Name: Port_BuildPinSet
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Pins - Port Pin ID numbers of the set, NumberOfPins - Entries in Pins
+* Parameters (inout): None
+* Parameters (out): PinSet - Pin set handle for the group services
+* Return value: Std_ReturnType - E_NOT_OK for an invalid pin, the handle is then left
+*                                 empty and not changeable
+* Description: Folds a list of pins into per-port masks once, so that the group
+*              services need no per-pin decoding. The JTAG pins PC0 to PC3 have no
+*              Port Pin ID (Tools/Port_CfgGen.py rejects them), so none is checked here.
+************************************************************************************/
+#if (PORT_PIN_GROUP_API == STD_ON)
+Std_ReturnType Port_BuildPinSet(const Port_PinType* Pins, uint8 NumberOfPins, Port_PinSetType* PinSet)
+{
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BUILD_PIN_SET, PORT_E_UNINIT);
+    return E_NOT_OK;
+  }
+  /* check if the input pointers are not NULL_PTR */
+  else if((Pins == NULL_PTR) || (PinSet == NULL_PTR))
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BUILD_PIN_SET, PORT_E_PARAM_POINTER);
+    return E_NOT_OK;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
+
+  for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    PinSet->PinMask[port]  = 0;
+    PinSet->PctlMask[port] = 0;
+  }
+  PinSet->DirChangeable  = TRUE;
+  PinSet->ModeChangeable = TRUE;
+
+  for (uint8 index = 0; index < NumberOfPins; index++)
+  {
+    Port_ConfigPins PinCfg;
+
+    /* check if incorrect Port Pin ID passed, the whole handle is left empty */
+    if(Pins[index] >= PORT_NUMBER_OF_PORT_PINS)
+    {
+      #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BUILD_PIN_SET, PORT_E_PARAM_PIN);
+      #endif
+      for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+      {
+        PinSet->PinMask[port]  = 0;
+        PinSet->PctlMask[port] = 0;
+      }
+      PinSet->DirChangeable  = FALSE;
+      PinSet->ModeChangeable = FALSE;
+      return E_NOT_OK;
+    }
+    else
+    {
+      PinCfg = Port_ConfigPtr->PortPins[Pins[index]];
+    }
+
+    PinSet->PinMask[PORT_CFG_GET_PORT(PinCfg)]  |= (uint8)(1U << PORT_CFG_GET_PIN(PinCfg));
+    PinSet->PctlMask[PORT_CFG_GET_PORT(PinCfg)] |= 0x0000000FUL << (PORT_CFG_GET_PIN(PinCfg) * 4);
+
+    if(PORT_CFG_GET_DIR_CHANGEABLE(PinCfg) == DIR_NOT_CHANGEABLE)
+    {
+      PinSet->DirChangeable = FALSE;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+
+    if(PORT_CFG_GET_MODE_CHANGEABLE(PinCfg) == MODE_NOT_CHANGEABLE)
+    {
+      PinSet->ModeChangeable = FALSE;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+  return E_OK;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_SetPinModeGroup
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): PinSet - Pin set handle, Mode - New Port Pin mode of every pin of the set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the mode of all the pins of the set in one step, with one write
+*              per register per port inside a critical section.
+************************************************************************************/
+#if (PORT_PIN_GROUP_API == STD_ON)
+void Port_SetPinModeGroup(const Port_PinSetType* PinSet, Port_PinModeType Mode)
+{
+  boolean error = FALSE;
+
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_GROUP, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if the input pointer is not a NULL_PTR */
+  else if(PinSet == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_GROUP, PORT_E_PARAM_POINTER);
+    error = TRUE;
+  }
+  /* check if the Port Pin Mode passed not valid */
+  else if(Mode > PORT_PIN_MODE_DIO)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_GROUP, PORT_E_PARAM_INVALID_MODE);
+    error = TRUE;
+  }
+  /* check if the API called when the mode of one of the pins is unchangeable */
+  else if(PinSet->ModeChangeable == FALSE)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_GROUP, PORT_E_MODE_UNCHANGEABLE);
+    error = TRUE;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
 
-      /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
-    }
+  if(FALSE == error)
+  {
+    /* PMCx value of the mode repeated in every field, masked per port below */
+    uint32 Pctl = ((Mode == PORT_PIN_MODE_DIO) || (Mode == PORT_PIN_MODE_ADC)) ? 0 : ((uint32)Mode * 0x11111111UL);
+    uint32 Saved;
 
-    if(Port_ConfigPtr->PortPins[index].PinDirection == PORT_PIN_OUT)
-    {
-      /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+    GPIO_HW_ENTER_CRITICAL(Saved);
 
-      if(Port_ConfigPtr->PortPins[index].PinLevelInitValue == STD_HIGH)
-      {
-        /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
-      }
-      else
-      {
-        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
-      }
-    }
-    
-    else if(Port_ConfigPtr->PortPins[index].PinDirection == PORT_PIN_IN)
+    for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
     {
-      /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+      uint32 mask     = PinSet->PinMask[port];
+      uint32 pctlMask = PinSet->PctlMask[port];
+      Gpio_RegsType * Regs = GPIO_HW_PORT(port);
 
-      if(Port_ConfigPtr->PortPins[index].InternalResistor == PULL_UP)
+      if(mask == 0)
       {
-        /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+        /* Do Nothing ... no pins of the set on this port */
       }
-      
-      else if(Port_ConfigPtr->PortPins[index].InternalResistor == PULL_DOWN)
+      else if(Mode == PORT_PIN_MODE_ADC)
       {
-        /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+        /* Disconnect the digital functions before enabling the analog one */
+        GPIO_HW_CLEAR_BITS(Regs->DEN,   mask);
+        GPIO_HW_CLEAR_BITS(Regs->AFSEL, mask);
+        GPIO_HW_CLEAR_BITS(Regs->PCTL,  pctlMask);
+        GPIO_HW_SET_BITS(Regs->AMSEL,   mask);
       }
-      
       else
       {
-        /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
-        
-        /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+        GPIO_HW_CLEAR_BITS(Regs->AMSEL, mask);
+        GPIO_HW_MERGE_BITS(Regs->AFSEL, mask, (Mode == PORT_PIN_MODE_DIO) ? 0U : mask);
+        GPIO_HW_MERGE_BITS(Regs->PCTL,  pctlMask, Pctl & pctlMask);
+        GPIO_HW_SET_BITS(Regs->DEN,     mask);
       }
     }
-    
-    else
-    {
-      /* Do Nothing */
-    }
+
+    GPIO_HW_EXIT_CRITICAL(Saved);
+  }
+  else
+  {
+    /* Do Nothing */
   }
 }
+#endif
 
 /************************************************************************************
-* Service Name: Port_SetPinDirection
-* Service ID[hex]: 0x01
+* Service Name: Port_SetPinDirectionGroup
+* Service ID[hex]: 0x09
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Pin - Port Pin ID number , PinDirection - Port Pin PinDirection
+* Parameters (in): PinSet - Pin set handle, Direction - New direction of every pin of the set
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Sets the port pin PinDirection.
+* Description: Sets the direction of all the pins of the set in one step, with one
+*              GPIODIR write per port inside a critical section.
 ************************************************************************************/
-#if (PORT_SET_PIN_PinDirection_API == STD_ON)
-void Port_SetPinPinDirection(Port_PinType Pin, Port_PinDirectionType PinDirection)
+#if (PORT_PIN_GROUP_API == STD_ON)
+void Port_SetPinDirectionGroup(const Port_PinSetType* PinSet, Port_PinDirectionType Direction)
 {
+  boolean error = FALSE;
+
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /* Check if the Driver is initialized before using this function */
   if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR, PORT_E_UNINIT);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_GROUP, PORT_E_UNINIT);
+    error = TRUE;
   }
-  else
-  {	
-    /* Do Nothing */	
-  }
-
-  /* check if incorrect Port Pin ID passed */
-  if(Pin >= PORT_CONFIGURED_PINS)
+  /* check if the input pointer is not a NULL_PTR */
+  else if(PinSet == NULL_PTR)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR, PORT_E_PARAM_PIN);
-  }
-  else
-  {	
-    /* Do Nothing */	
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_GROUP, PORT_E_PARAM_POINTER);
+    error = TRUE;
   }
-
-  /* check if Port Pin not configured as changeable */
-  if(Port_ConfigPtr->PortPins[Pin].DirChangeability == STD_OFF)
+  /* check if one of the pins is not configured as changeable */
+  else if(PinSet->DirChangeable == FALSE)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR, PORT_E_PinDirection_UNCHANGEABLE);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_GROUP, PORT_E_DIRECTION_UNCHANGEABLE);
+    error = TRUE;
   }
   else
-  {	
-    /* Do Nothing */	
+  {
+    /* Do Nothing */
   }
   #endif
-  
-  volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
 
-  switch(Port_ConfigPtr->PortPins[Pin].PortNum)
+  if(FALSE == error)
   {
-    case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; break;
-    case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; break;
-    case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; break;
-    case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; break;
-    case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; break;
-    case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; break;
-  }
+    uint32 Saved;
 
-  if( (Port_ConfigPtr->PortPins[Pin].PortNum == 2) && (Port_ConfigPtr->PortPins[Pin].PinNum <= 3)) /* PC0 to PC3 */
-  {
-    /* Do Nothing ...  this is a JTAG pin */
-    return;
-  }
+    GPIO_HW_ENTER_CRITICAL(Saved);
 
-  if(PinDirection == PORT_PIN_OUT)
-  {
-    /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
-  }
-  else if(PinDirection == PORT_PIN_IN)
-  {
-    /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
+    for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      uint32 mask = PinSet->PinMask[port];
+
+      if(mask == 0)
+      {
+        /* Do Nothing ... no pins of the set on this port */
+      }
+      else if(Direction == PORT_PIN_OUT)
+      {
+        GPIO_HW_SET_BITS(GPIO_HW_PORT(port)->DIR, mask);
+      }
+      else
+      {
+        GPIO_HW_CLEAR_BITS(GPIO_HW_PORT(port)->DIR, mask);
+      }
+    }
+
+    GPIO_HW_EXIT_CRITICAL(Saved);
   }
   else
-  {	
-    /* Do Nothing */	
+  {
+    /* Do Nothing */
   }
 }
 #endif
 
 /************************************************************************************
-* Service Name: Port_RefreshPortDirection
-* Service ID[hex]: 0x02
+* Service Name: Port_SwitchConfig
+* Service ID[hex]: 0x0A
 * Sync/Async: Synchronous
 * Reentrancy: Non reentrant
-* Parameters (in): None
+* Parameters (in): From - Configuration set currently applied, To - Configuration set to apply
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: None
-* Description: Refreshes port PinDirection.
+* Return value: Std_ReturnType - E_NOT_OK if the switch was rejected, nothing written
+* Description: Switches the port pins to another configuration set by writing only
+*              the register bits that differ between the two sets. A port whose
+*              bits differ must be clocked (see Port_UngatePortClocks).
 ************************************************************************************/
-void Port_RefreshPortPinDirection(void)
+#if (PORT_SWITCH_CONFIG_API == STD_ON)
+Std_ReturnType Port_SwitchConfig(const Port_ConfigType* From, const Port_ConfigType* To)
 {
+  boolean error = FALSE;
+  Std_ReturnType result = E_NOT_OK;
+
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /* Check if the Driver is initialized before using this function */
   if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESH_PORT_DIRECTION, PORT_E_UNINIT);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if the input configuration pointers are not NULL_PTR */
+  else if((From == NULL_PTR) || (To == NULL_PTR))
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG, PORT_E_PARAM_CONFIG);
+    error = TRUE;
+  }
+  /* check if From is the set currently applied and To is a valid set */
+  else if((From != Port_ConfigPtr) || (To->ConfigSetId >= PORT_NUMBER_OF_CONFIG_SETS))
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG, PORT_E_PARAM_CONFIG);
+    error = TRUE;
   }
   else
-  {	
-    /* Do Nothing */	
+  {
+    /* Do Nothing */
   }
   #endif
-  
-  for(Port_PinType index = 0; index < PORT_NUMBER_OF_PORT_PINS; index++)
+
+  if(FALSE == error)
   {
-    volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+    uint32 Saved;
+    /* Ports the switch writes. The whole switch is rejected when one of them is gated
+       (Port_GatePortClocks): an access to a port not ready in PRGPIO faults, and a
+       gated port keeps its registers, so skipping it would leave it on the From set. */
+    uint8 PortsWritten = 0;
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+    /* Register updates generated offline for this pair of sets */
+    const Port_ConfigDeltaType* Delta = &Port_ConfigDeltas[From->ConfigSetId][To->ConfigSetId];
 
-    switch(Port_ConfigPtr->PortPins[index].PortNum)
+    for (uint8 entry = 0; entry < Delta->Count; entry++)
     {
-      case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; break;
-      case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; break;
-      case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; break;
-      case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; break;
-      case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; break;
-      case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; break;
+      PortsWritten |= (uint8)(1U << Delta->Entries[entry].PortNum);
     }
+#else
+    Port_PortImageType FromImages[PORT_NUMBER_OF_PORTS];
+    Port_PortImageType ToImages[PORT_NUMBER_OF_PORTS];
 
-    if( (Port_ConfigPtr->PortPins[index].PortNum == 2) && (Port_ConfigPtr->PortPins[index].PinNum <= 3)) /* PC0 to PC3 */
+    Port_BuildPortImages(From, FromImages);
+    Port_BuildPortImages(To, ToImages);
+
+    for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
     {
-      /* Do Nothing ...  this is a JTAG pin */
-      continue;
+      if(Port_PortDeltaBits(&FromImages[port], &ToImages[port]) != 0)
+      {
+        PortsWritten |= (uint8)(1U << port);
+      }
+      else
+      {
+        /* Do Nothing ... port identical in both configuration sets */
+      }
     }
+#endif
 
-    /* PORT061: The function Port_RefreshPortPinDirection shall exclude those port pins from
-      refreshing that are configured as "pin PinDirection changeable during runtime" */
-    if (Port_ConfigPtr->PortPins[index].DirChangeability == STD_OFF)
+    if((PortsWritten & ~GPIO_HW_READ(GPIO_HW_PRGPIO_REG)) != 0)
+    {
+      #if (PORT_DEV_ERROR_DETECT == STD_ON)
+      Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG, PORT_E_PORT_NOT_READY);
+      #endif
+    }
+    else
     {
-      if(Port_ConfigPtr->PortPins[index].PinDirection == PORT_PIN_OUT)
+      GPIO_HW_ENTER_CRITICAL(Saved);
+
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+      for (uint8 entry = 0; entry < Delta->Count; entry++)
       {
-              /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-              SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
+        const Port_RegDeltaType* Update = &Delta->Entries[entry];
+
+        Port_WriteRegBits(&((volatile uint32 *)GPIO_HW_PORT(Update->PortNum))[Update->RegIndex], Update->Mask, Update->Value);
       }
-      else if(Port_ConfigPtr->PortPins[index].PinDirection == PORT_PIN_IN)
+#else
+      for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
       {
-              /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-              CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->PortPins[index].PinNum);
-      }
-      
-      else
-      {	
-        /* Do Nothing */	
+        Port_WritePortDelta(GPIO_HW_PORT(port), &FromImages[port], &ToImages[port]);
       }
+#endif
+
+      GPIO_HW_EXIT_CRITICAL(Saved);
+
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+      Port_StorePortMasks(Port_PrecompiledImages[To->ConfigSetId].Ports);
+#else
+      Port_StorePortMasks(ToImages);
+#endif
+      Port_ConfigPtr = To;
+      result = E_OK;
     }
-    else
-    {	/* Do Nothing */	}
   }
+  else
+  {
+    /* Do Nothing */
+  }
+  return result;
 }
+#endif
 
-#if (PORT_VERSION_INFO_API == STD_ON)
-void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
+/************************************************************************************
+* Service Name: Port_SaveContext
+* Service ID[hex]: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Context - RAM image of the live GPIO register state
+* Return value: None
+* Description: Snapshots the GPIO clock gating and the registers of the
+*              configured pins of every clocked port before a low-power phase
+*              that loses the GPIO state. Gated ports are not saved.
+************************************************************************************/
+#if (PORT_CONTEXT_API == STD_ON)
+void Port_SaveContext(Port_ContextType* Context)
 {
+  boolean error = FALSE;
+
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
-  /* check if the input configuration pointer is not a NULL_PTR */
-  if(versioninfo == NULL_PTR)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO, PORT_E_PARAM_POINTER);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SAVE_CONTEXT, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if the output pointer is not a NULL_PTR */
+  else if(Context == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SAVE_CONTEXT, PORT_E_PARAM_POINTER);
+    error = TRUE;
   }
   else
   {
-    /* Do Nothing */	
+    /* Do Nothing */
   }
+  #endif
 
-  /* Check if the Driver is initialized before using this function */
-  if(Port_Status == PORT_NOT_INITIALIZED)
+  if(FALSE == error)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO, PORT_E_UNINIT);
+    /* Live clock gating, Port_GatePortClocks may have gated some configured ports */
+    uint8 ReadyMask = (uint8)GPIO_HW_READ(GPIO_HW_PRGPIO_REG);
+
+    Context->ClockMask = (uint8)(GPIO_HW_READ(GPIO_HW_RCGCGPIO_REG) & GPIO_HW_ALL_PORTS_MASK);
+
+    for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      Port_PortImageType * Image = &Context->Ports[port];
+      uint8 mask = Port_PinMask[port];
+
+      /* A gated port cannot be read, it is not saved and Port_RestoreContext leaves it */
+      if(!BIT_IS_SET(ReadyMask, port))
+      {
+        mask = 0;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+
+      Image->PinMask    = mask;
+      Image->CommitMask = Port_CommitMask[port];
+      Image->DirFixed   = Port_FixedDirMask[port];
+
+      if(mask != 0)
+      {
+        Gpio_RegsType * Regs = GPIO_HW_PORT(port);
+
+        Image->Dir   = (uint8)(GPIO_HW_READ(Regs->DIR)   & mask);
+        Image->Den   = (uint8)(GPIO_HW_READ(Regs->DEN)   & mask);
+        Image->Amsel = (uint8)(GPIO_HW_READ(Regs->AMSEL) & mask);
+        Image->Afsel = (uint8)(GPIO_HW_READ(Regs->AFSEL) & mask);
+        Image->Pur   = (uint8)(GPIO_HW_READ(Regs->PUR)   & mask);
+        Image->Pdr   = (uint8)(GPIO_HW_READ(Regs->PDR)   & mask);
+        Image->Data  = (uint8)(GPIO_HW_READ(Regs->DATA[GPIO_HW_DATA_ALL_PINS]) & mask);
+        Image->Dr2r  = (uint8)(GPIO_HW_READ(Regs->DR2R)  & mask);
+        Image->Dr4r  = (uint8)(GPIO_HW_READ(Regs->DR4R)  & mask);
+        Image->Dr8r  = (uint8)(GPIO_HW_READ(Regs->DR8R)  & mask);
+        Image->Odr   = (uint8)(GPIO_HW_READ(Regs->ODR)   & mask);
+        Image->Slr   = (uint8)(GPIO_HW_READ(Regs->SLR)   & mask);
+        Image->Pctl  = GPIO_HW_READ(Regs->PCTL) & Port_PctlMask(mask);
+      }
+      else
+      {
+        /* Do Nothing ... no pins configured on this port, or port not clocked */
+      }
+    }
   }
   else
-   {	
-     /* Do Nothing */	
-   }
-  #endif
-
-  /* Copy the module Id */
-  versioninfo->moduleID = (uint16)PORT_MODULE_ID;
-  /* Copy the vendor Id */
-  versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
-  /* Copy Software Major Version */
-  versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
-  /* Copy Software Minor Version */
-  versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
-  /* Copy Software Patch Version */
-  versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+  {
+    /* Do Nothing */
+  }
 }
 #endif
 
 /************************************************************************************
-* Service Name: Port_SetPinMode
-* Service ID[hex]: 0x04
+* Service Name: Port_RestoreContext
+* Service ID[hex]: 0x0C
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
-* Parameters (in): Pin - Port Pin ID number, Mode - New Port Pin mode to be set on port pin
+* Reentrancy: Non reentrant
+* Parameters (in): Context - RAM image taken by Port_SaveContext
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Sets the port pin mode.
+* Description: Writes the saved register state back after wake-up: the saved
+*              clock gating in one write, PD7/PF0 unlocking, then every register
+*              once per saved port.
 ************************************************************************************/
-#if (PORT_SET_PIN_MODE_API == STD_ON)
-void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+#if (PORT_CONTEXT_API == STD_ON)
+void Port_RestoreContext(const Port_ContextType* Context)
 {
+  boolean error = FALSE;
+
   #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /* Check if the Driver is initialized before using this function */
   if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_UNINIT);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_RESTORE_CONTEXT, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if the input pointer is not a NULL_PTR */
+  else if(Context == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_RESTORE_CONTEXT, PORT_E_PARAM_POINTER);
+    error = TRUE;
   }
   else
-  {	
-    /* Do Nothing */	
+  {
+    /* Do Nothing */
   }
+  #endif
 
-  /* check if incorrect Port Pin ID passed */
-  if(Pin >= PORT_NUMBER_OF_PORT_PINS)
+  if(FALSE == error)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_PARAM_PIN);
+#if (PORT_AHB_APERTURE == STD_ON)
+    GPIO_HW_SET_BITS(GPIO_HW_HBCTL_REG, GPIO_HW_ALL_PORTS_MASK);
+#endif
+
+    /* Back to the clock gating seen by Port_SaveContext, the ports gated then stay gated */
+    GPIO_HW_WRITE(GPIO_HW_RCGCGPIO_REG, Context->ClockMask);
+
+    while((GPIO_HW_READ(GPIO_HW_PRGPIO_REG) & Context->ClockMask) != Context->ClockMask)
+    {
+      /* Wait until the ports are ready */
+    }
+
+    for (uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      if(Context->Ports[port].PinMask != 0)
+      {
+        Gpio_RegsType * Regs = GPIO_HW_PORT(port);
+
+        if(Context->Ports[port].CommitMask != 0)
+        {
+          Port_UnlockPort(Regs, Context->Ports[port].CommitMask);
+        }
+        else
+        {
+          /* Do Nothing ... No need to unlock the commit register for this port */
+        }
+
+        Port_WritePortImage(Regs, &Context->Ports[port]);
+      }
+      else
+      {
+        /* Do Nothing ... no pins configured on this port */
+      }
+    }
   }
   else
-   {	
-     /* Do Nothing */	
-   }
+  {
+    /* Do Nothing */
+  }
+}
+#endif
 
-  /* check if the Port Pin Mode passed not valid */
-  if(Mode > PORT_PIN_MODE_DIO)
+/************************************************************************************
+* Service Name: Port_GatePortClocks
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortMask - Ports to stop (bit 0 = PORTA ... bit 5 = PORTF)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Gates the clock of idle ports. Their registers must not be accessed
+*              (Port or Dio) until Port_UngatePortClocks is called for them.
+************************************************************************************/
+#if (PORT_CLOCK_GATING_API == STD_ON)
+void Port_GatePortClocks(uint8 PortMask)
+{
+  boolean error = FALSE;
+
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_PARAM_INVALID_MODE);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GATE_PORT_CLOCKS, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* Check if the mask only holds existing ports */
+  else if((PortMask >> PORT_NUMBER_OF_PORTS) != 0)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GATE_PORT_CLOCKS, PORT_E_PARAM_PORT_MASK);
+    error = TRUE;
   }
   else
-  {	
-    /* Do Nothing */	
+  {
+    /* Do Nothing */
   }
+  #endif
 
-  /* check if the API called when the mode is unchangeable */
-  if(Port_ConfigPtr->PortPins[Pin].ModeChangeability == STD_OFF)
+  if(FALSE == error)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE, PORT_E_MODE_UNCHANGEABLE);
+    GPIO_HW_CLEAR_BITS(GPIO_HW_RCGCGPIO_REG, PortMask);
   }
   else
-  {	
-    /* Do Nothing */	
+  {
+    /* Do Nothing */
   }
-  #endif
+}
+#endif
 
-  volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+/************************************************************************************
+* Service Name: Port_UngatePortClocks
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortMask - Ports to restart (bit 0 = PORTA ... bit 5 = PORTF)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Restores the clock of the given ports and returns once they are ready.
+*              The port registers keep their configuration while gated.
+************************************************************************************/
+#if (PORT_CLOCK_GATING_API == STD_ON)
+void Port_UngatePortClocks(uint8 PortMask)
+{
+  boolean error = FALSE;
 
-  switch(Port_ConfigPtr->PortPins[Pin].PortNum)
+  #if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Port_Status == PORT_NOT_INITIALIZED)
   {
-    case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; break;
-    case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; break;
-    case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; break;
-    case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; break;
-    case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; break;
-    case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; break;
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_UNGATE_PORT_CLOCKS, PORT_E_UNINIT);
+    error = TRUE;
   }
-
-  if((Port_ConfigPtr->PortPins[Pin].PortNum == 2) && (Port_ConfigPtr->PortPins[Pin].PinNum <= 3)) /* PC0 to PC3 */
+  /* Check if the mask only holds existing ports */
+  else if((PortMask >> PORT_NUMBER_OF_PORTS) != 0)
   {
-    /* Do Nothing ...  this is a JTAG pin */
-    return;
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_UNGATE_PORT_CLOCKS, PORT_E_PARAM_PORT_MASK);
+    error = TRUE;
   }
-
-  if (Mode == PORT_PIN_MODE_DIO)
+  else
   {
-    /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
-
-    /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
-
-    /* Clear the PMCx bits for this pin */
-    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->PortPins[Pin].PinNum * 4));
-
-    /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
+    /* Do Nothing */
   }
-  else if (Mode == PORT_PIN_MODE_ADC)
-  {
-    /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
-
-    /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
+  #endif
 
-    /* Clear the PMCx bits for this pin */
-    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->PortPins[Pin].PinNum * 4));
+  if(FALSE == error)
+  {
+    GPIO_HW_SET_BITS(GPIO_HW_RCGCGPIO_REG, PortMask);
 
-    /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
+    while((GPIO_HW_READ(GPIO_HW_PRGPIO_REG) & PortMask) != PortMask)
+    {
+      /* Wait until the ports are ready */
+    }
   }
-  else /* Another mode */
+  else
   {
-    /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
-
-    /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
-
-    /* Set the PMCx bits for this pin */
-    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Mode & 0x0000000F << (Port_ConfigPtr->PortPins[Pin].PinNum * 4));
-
-    /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->PortPins[Pin].PinNum);
+    /* Do Nothing */
   }
 }
+#endif
+
 /*******************************************************************************
  END OF FILE                                     
 ********************************************************************************/
-#endif
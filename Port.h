@@ -66,6 +66,14 @@
 #define PORT_REFRESH_PORT_DIRECTION (uint8)0x02
 #define PORT_GET_VERSION_INFO       (uint8)0x03
 #define PORT_SET_PIN_MODE           (uint8)0x04
+#define PORT_GATE_PORT_CLOCKS       (uint8)0x05
+#define PORT_UNGATE_PORT_CLOCKS     (uint8)0x06
+#define PORT_BUILD_PIN_SET          (uint8)0x07
+#define PORT_SET_PIN_MODE_GROUP     (uint8)0x08
+#define PORT_SET_PIN_DIRECTION_GROUP (uint8)0x09
+#define PORT_SWITCH_CONFIG          (uint8)0x0A
+#define PORT_SAVE_CONTEXT           (uint8)0x0B
+#define PORT_RESTORE_CONTEXT        (uint8)0x0C
 /******************************************************************************
  *      DET ERROR MACROS (from 7.2 Error Classification)                       *
  ******************************************************************************/
@@ -76,6 +84,8 @@
 #define PORT_E_MODE_UNCHANGEABLE         (uint8)0x0E /* API Port_SetPinMode service called when the mode is unchangeable */
 #define PORT_E_UNINIT                    (uint8)0x0F /* API service called without module initialization */
 #define PORT_E_PARAM_POINTER             (uint8)0x10 /* API called with a NULL Pointer Parameter  */
+#define PORT_E_PARAM_PORT_MASK           (uint8)0x11 /* Port mask holding ports that do not exist */
+#define PORT_E_PORT_NOT_READY            (uint8)0x12 /* Port written by the service is not ready in PRGPIO (clock gated) */
 /******************************************************************************
  *      DATA TYPES (from 8.2 Type definitions)                                *
  ******************************************************************************/
@@ -141,28 +151,175 @@ typedef enum
   MODE_IS_CHANGEABLE 
 }               Port_PinModeChangeability;
 
-/* Data Structure required for initializing the port Driver */
-typedef struct 
+/* Defining the output drive strength of a port pin (GPIODR2R/GPIODR4R/GPIODR8R) */
+typedef enum
 {
-  
-  Port_PortNumType		PortNum;
-  Port_PinNumType		PinNum;
-  Port_PinDirectionType		PinDirection;
-  Port_InternalResistorType 	InternalResistor;
-  Port_PinLevelInitValue	PinLevelInitValue;
-  Port_PinModeType 		PinInitMode;
-  Port_PinDirChangeability 	DirChangeability;
-  Port_PinModeChangeability	ModeChangeability;
-  
-} Port_ConfigPins;
+  PORT_PIN_DRIVE_2MA,
+  PORT_PIN_DRIVE_4MA,
+  PORT_PIN_DRIVE_8MA
+}               Port_PinDriveStrengthType;
+
+/* Defining the slew rate control of a port pin (GPIOSLR, 8 mA drive only) */
+typedef enum
+{
+  PORT_PIN_SLEW_CONTROL_OFF,
+  PORT_PIN_SLEW_CONTROL_ON
+}               Port_PinSlewRateType;
+
+/* Defining the output type of a port pin (GPIOODR) */
+typedef enum
+{
+  PORT_PIN_PUSH_PULL,
+  PORT_PIN_OPEN_DRAIN
+}               Port_PinOutputType;
+
+/* Packed descriptor of one port pin, built with PORT_CFG_PIN/PORT_CFG_PIN_EX and read with the PORT_CFG_GET_xxx accessors:
+ *   bits 0-2   : Port_PortNumType           bits 3-5   : Port_PinNumType
+ *   bit  6     : Port_PinDirectionType      bits 7-8   : Port_InternalResistorType
+ *   bit  9     : Port_PinLevelInitValue     bits 10-13 : Port_PinModeType
+ *   bit  14    : Port_PinDirChangeability   bit  15    : Port_PinModeChangeability
+ *   bits 16-17 : Port_PinDriveStrengthType  bit  18    : Port_PinSlewRateType
+ *   bit  19    : Port_PinOutputType */
+typedef uint32 Port_ConfigPins;
+
+#define PORT_CFG_PORT_POS               (0U)
+#define PORT_CFG_PIN_POS                (3U)
+#define PORT_CFG_DIRECTION_POS          (6U)
+#define PORT_CFG_RESISTOR_POS           (7U)
+#define PORT_CFG_LEVEL_POS              (9U)
+#define PORT_CFG_MODE_POS               (10U)
+#define PORT_CFG_DIR_CHANGEABLE_POS     (14U)
+#define PORT_CFG_MODE_CHANGEABLE_POS    (15U)
+#define PORT_CFG_DRIVE_POS              (16U)
+#define PORT_CFG_SLEW_POS               (18U)
+#define PORT_CFG_OUTPUT_TYPE_POS        (19U)
+
+/* Builds the packed descriptor of one port pin, including its output electrical attributes */
+#define PORT_CFG_PIN_EX(PortNum, PinNum, Direction, Resistor, Level, Mode, DirChangeability, ModeChangeability, Drive, Slew, OutputType) \
+  ((Port_ConfigPins)( ((uint32)(PortNum)           << PORT_CFG_PORT_POS)            \
+                    | ((uint32)(PinNum)            << PORT_CFG_PIN_POS)             \
+                    | ((uint32)(Direction)         << PORT_CFG_DIRECTION_POS)       \
+                    | ((uint32)(Resistor)          << PORT_CFG_RESISTOR_POS)        \
+                    | ((uint32)(Level)             << PORT_CFG_LEVEL_POS)           \
+                    | ((uint32)(Mode)              << PORT_CFG_MODE_POS)            \
+                    | ((uint32)(DirChangeability)  << PORT_CFG_DIR_CHANGEABLE_POS)  \
+                    | ((uint32)(ModeChangeability) << PORT_CFG_MODE_CHANGEABLE_POS) \
+                    | ((uint32)(Drive)             << PORT_CFG_DRIVE_POS)           \
+                    | ((uint32)(Slew)              << PORT_CFG_SLEW_POS)            \
+                    | ((uint32)(OutputType)        << PORT_CFG_OUTPUT_TYPE_POS) ))
+
+/* Builds the packed descriptor of one port pin with the reset electrical attributes (2 mA, push-pull) */
+#define PORT_CFG_PIN(PortNum, PinNum, Direction, Resistor, Level, Mode, DirChangeability, ModeChangeability) \
+  PORT_CFG_PIN_EX(PortNum, PinNum, Direction, Resistor, Level, Mode, DirChangeability, ModeChangeability, \
+                  PORT_PIN_DRIVE_2MA, PORT_PIN_SLEW_CONTROL_OFF, PORT_PIN_PUSH_PULL)
+
+/* High-speed output preset for clock, bus and timer-driven lines: 8 mA drive, no slew rate control
+ * (GPIOSLR slows the edges down, it is for the lines that must not ring, not for the fast ones) */
+#define PORT_CFG_PIN_HIGH_SPEED(PortNum, PinNum, Level, Mode, DirChangeability, ModeChangeability) \
+  PORT_CFG_PIN_EX(PortNum, PinNum, PORT_PIN_OUT, OFF, Level, Mode, DirChangeability, ModeChangeability, \
+                  PORT_PIN_DRIVE_8MA, PORT_PIN_SLEW_CONTROL_OFF, PORT_PIN_PUSH_PULL)
+
+/* Accessors of the packed descriptor fields */
+#define PORT_CFG_GET_PORT(Cfg)              ((Port_PortNumType)(((Cfg) >> PORT_CFG_PORT_POS) & 0x07U))
+#define PORT_CFG_GET_PIN(Cfg)               ((Port_PinNumType)(((Cfg) >> PORT_CFG_PIN_POS) & 0x07U))
+#define PORT_CFG_GET_DIRECTION(Cfg)         ((Port_PinDirectionType)(((Cfg) >> PORT_CFG_DIRECTION_POS) & 0x01U))
+#define PORT_CFG_GET_RESISTOR(Cfg)          ((Port_InternalResistorType)(((Cfg) >> PORT_CFG_RESISTOR_POS) & 0x03U))
+#define PORT_CFG_GET_LEVEL(Cfg)             ((Port_PinLevelInitValue)(((Cfg) >> PORT_CFG_LEVEL_POS) & 0x01U))
+#define PORT_CFG_GET_MODE(Cfg)              ((Port_PinModeType)(((Cfg) >> PORT_CFG_MODE_POS) & 0x0FU))
+#define PORT_CFG_GET_DIR_CHANGEABLE(Cfg)    ((Port_PinDirChangeability)(((Cfg) >> PORT_CFG_DIR_CHANGEABLE_POS) & 0x01U))
+#define PORT_CFG_GET_MODE_CHANGEABLE(Cfg)   ((Port_PinModeChangeability)(((Cfg) >> PORT_CFG_MODE_CHANGEABLE_POS) & 0x01U))
+#define PORT_CFG_GET_DRIVE(Cfg)             ((Port_PinDriveStrengthType)(((Cfg) >> PORT_CFG_DRIVE_POS) & 0x03U))
+#define PORT_CFG_GET_SLEW(Cfg)              ((Port_PinSlewRateType)(((Cfg) >> PORT_CFG_SLEW_POS) & 0x01U))
+#define PORT_CFG_GET_OUTPUT_TYPE(Cfg)       ((Port_PinOutputType)(((Cfg) >> PORT_CFG_OUTPUT_TYPE_POS) & 0x01U))
 
 /* An array carrying the initialization configurations */
 typedef struct
 {
+  uint8           ConfigSetId;                               /* PortConf_xxx_CONFIG_SET_ID of this set */
   Port_ConfigPins PortPins [ PORT_NUMBER_OF_PORT_PINS ];     
 } Port_ConfigType;
 
+/* Register image of one GPIO port, folded from all the pins configured on that port */
+typedef struct
+{
+  uint8  PinMask;       /* Pins of the port owned by the configuration (JTAG pins excluded) */
+  uint8  CommitMask;    /* Locked pins (PD7/PF0) that need GPIOLOCK/GPIOCR unlocking */
+  uint8  Dir;           /* GPIODIR bits of the owned pins */
+  uint8  DirFixed;      /* Owned pins whose direction is not changeable, kept by Port_RefreshPortDirection */
+  uint8  Den;           /* GPIODEN bits of the owned pins */
+  uint8  Amsel;         /* GPIOAMSEL bits of the owned pins */
+  uint8  Afsel;         /* GPIOAFSEL bits of the owned pins */
+  uint8  Pur;           /* GPIOPUR bits of the owned pins */
+  uint8  Pdr;           /* GPIOPDR bits of the owned pins */
+  uint8  Data;          /* GPIODATA initial level of the owned pins */
+  uint8  Dr2r;          /* GPIODR2R bits of the owned pins */
+  uint8  Dr4r;          /* GPIODR4R bits of the owned pins */
+  uint8  Dr8r;          /* GPIODR8R bits of the owned pins */
+  uint8  Odr;           /* GPIOODR bits of the owned pins */
+  uint8  Slr;           /* GPIOSLR bits of the owned pins */
+  uint32 Pctl;          /* GPIOPCTL PMCx fields of the owned pins */
+} Port_PortImageType;
+
+/* One entry of the ordered GPIOLOCK/GPIOCR unlock list */
+typedef struct
+{
+  uint8  PortNum;       /* Port holding the locked pins */
+  uint8  CommitMask;    /* Bits to set in GPIOCR of that port */
+} Port_UnlockType;
+
+/* Precompiled register images of a configuration set, generated by Tools/Port_CfgGen.py */
+typedef struct
+{
+  uint8              ClockMask;                                 /* Ports with at least one configured pin */
+  uint8              UnlockCount;                               /* Valid entries in the Unlock list */
+  Port_UnlockType    Unlock [ PORT_MAX_UNLOCK_ENTRIES ];        /* Ports to unlock before writing the images */
+  Port_PortImageType Ports  [ PORT_NUMBER_OF_PORTS ];           /* Register image of every port */
+} Port_ImageSetType;
+
+/* Set of pins reconfigured together by the group services, built once by Port_BuildPinSet */
+typedef struct
+{
+  uint8   PinMask  [ PORT_NUMBER_OF_PORTS ];    /* Pins of the set on every port */
+  uint32  PctlMask [ PORT_NUMBER_OF_PORTS ];    /* GPIOPCTL PMCx fields of those pins */
+  boolean DirChangeable;                        /* TRUE when every pin of the set has a changeable direction */
+  boolean ModeChangeable;                       /* TRUE when every pin of the set has a changeable mode */
+} Port_PinSetType;
+
+/* Live GPIO register state of the configured pins, taken by Port_SaveContext */
+typedef struct
+{
+  uint8              ClockMask;                         /* RCGCGPIO when saved, restored as is */
+  Port_PortImageType Ports [ PORT_NUMBER_OF_PORTS ];    /* Saved registers of every port, PinMask 0 if not saved */
+} Port_ContextType;
+
+/* One register update of a configuration switch, only the bits in Mask are written */
+typedef struct
+{
+  uint8  PortNum;       /* Port of the register */
+  uint16 RegIndex;      /* Word index of the register in the GPIO register block (offset / 4) */
+  uint32 Mask;          /* Bits differing between the two configuration sets */
+  uint32 Value;         /* New value of those bits */
+} Port_RegDeltaType;
+
+/* Register updates switching from one configuration set to another, generated by Tools/Port_CfgGen.py */
+typedef struct
+{
+  uint8                    Count;       /* Entries in the list */
+  const Port_RegDeltaType* Entries;     /* Updates in register write order */
+} Port_ConfigDeltaType;
+
+/* Notification of the pins found with a drifted direction by Port_RefreshPortDirection */
+typedef void (*Port_DirectionDriftNotificationType)( Port_PortNumType PortNum, uint8 DriftMask );
+
 extern const Port_ConfigType PortConfigrations;  /* 8.2.1 external data structure containing all initialization data */
+extern const Port_ConfigType PortConfigDiagnostic;      /* Diagnostic profile, UART0 on PA0/PA1 */
+extern const Port_ConfigType PortConfigLowPower;        /* Low-power profile, no floating inputs */
+
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+/* Generated in Port_PBimage.c from the configuration sets, indexed by ConfigSetId */
+extern const Port_ImageSetType Port_PrecompiledImages[ PORT_NUMBER_OF_CONFIG_SETS ];
+extern const Port_ConfigDeltaType Port_ConfigDeltas[ PORT_NUMBER_OF_CONFIG_SETS ][ PORT_NUMBER_OF_CONFIG_SETS ];
+#endif
 
 /******************************************************************************
  *      FUNCTION PROTOTYPES (from 8.3 Function Definitions)                   *
@@ -191,7 +348,7 @@ void Port_Init( const Port_ConfigType* ConfigPtr );
 * Return value: None
 * Description: Function to Sets the port pin direction.
 ********************************************************************************/
-#if (PortSetPinDirectionApi == TRUE)
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
 void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction );
 #endif
 
@@ -208,6 +365,18 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction );
 ********************************************************************************/
 void Port_RefreshPortDirection ( void );
 
+/*******************************************************************************
+* Service Name: Port_GetDirectionDriftCount
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of pins restored by Port_RefreshPortDirection
+* Description: Returns how many pin directions were found drifted since Port_Init.
+********************************************************************************/
+uint32 Port_GetDirectionDriftCount ( void );
+
 /*******************************************************************************
 * Service Name: Port_GetVersionInfo
 * Service ID[hex]: 0x03
@@ -219,7 +388,7 @@ void Port_RefreshPortDirection ( void );
 * Return value: None
 * Description: Returns the version information of this module.
 ********************************************************************************/
-#if (PortVersionInfoApi == STD_ON)
+#if (PORT_VERSION_INFO_API == STD_ON)
 void Port_GetVersionInfo ( Std_VersionInfoType* versioninfo );
 #endif
 
@@ -234,7 +403,142 @@ void Port_GetVersionInfo ( Std_VersionInfoType* versioninfo );
 * Return value: None
 * Description: Sets the port pin mode.
 ********************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
 void Port_SetPinMode ( Port_PinType Pin, Port_PinModeType Mode );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_BuildPinSet
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Pins - Port Pin ID numbers of the set, NumberOfPins - Entries in Pins
+* Parameters (inout): None
+* Parameters (out): PinSet - Pin set handle for the group services
+* Return value: Std_ReturnType - E_NOT_OK for an invalid pin, the handle is then left
+*                                 empty and not changeable
+* Description: Folds a list of pins into per-port masks once, so that the group
+*              services need no per-pin decoding. The JTAG pins PC0 to PC3 have no
+*              Port Pin ID (Tools/Port_CfgGen.py rejects them), so none is checked here.
+********************************************************************************/
+#if (PORT_PIN_GROUP_API == STD_ON)
+Std_ReturnType Port_BuildPinSet( const Port_PinType* Pins, uint8 NumberOfPins, Port_PinSetType* PinSet );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_SetPinModeGroup
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): PinSet - Pin set handle, Mode - New Port Pin mode of every pin of the set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the mode of all the pins of the set in one step, with one write
+*              per register per port inside a critical section.
+********************************************************************************/
+#if (PORT_PIN_GROUP_API == STD_ON)
+void Port_SetPinModeGroup( const Port_PinSetType* PinSet, Port_PinModeType Mode );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_SetPinDirectionGroup
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): PinSet - Pin set handle, Direction - New direction of every pin of the set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the direction of all the pins of the set in one step, with one
+*              GPIODIR write per port inside a critical section.
+********************************************************************************/
+#if (PORT_PIN_GROUP_API == STD_ON)
+void Port_SetPinDirectionGroup( const Port_PinSetType* PinSet, Port_PinDirectionType Direction );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_SwitchConfig
+* Service ID[hex]: 0x0A
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): From - Configuration set currently applied, To - Configuration set to apply
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the switch was rejected, nothing written
+* Description: Switches the port pins to another configuration set by writing only
+*              the register bits that differ between the two sets. A port whose
+*              bits differ must be clocked (see Port_UngatePortClocks).
+********************************************************************************/
+#if (PORT_SWITCH_CONFIG_API == STD_ON)
+Std_ReturnType Port_SwitchConfig( const Port_ConfigType* From, const Port_ConfigType* To );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_SaveContext
+* Service ID[hex]: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): Context - RAM image of the live GPIO register state
+* Return value: None
+* Description: Snapshots the GPIO clock gating and the registers of the
+*              configured pins of every clocked port before a low-power phase
+*              that loses the GPIO state. Gated ports are not saved.
+********************************************************************************/
+#if (PORT_CONTEXT_API == STD_ON)
+void Port_SaveContext( Port_ContextType* Context );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_RestoreContext
+* Service ID[hex]: 0x0C
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Context - RAM image taken by Port_SaveContext
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Writes the saved register state back after wake-up: the saved
+*              clock gating in one write, PD7/PF0 unlocking, then every register
+*              once per saved port.
+********************************************************************************/
+#if (PORT_CONTEXT_API == STD_ON)
+void Port_RestoreContext( const Port_ContextType* Context );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_GatePortClocks
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortMask - Ports to stop (bit 0 = PORTA ... bit 5 = PORTF)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Gates the clock of idle ports. Their registers must not be accessed
+*              (Port or Dio) until Port_UngatePortClocks is called for them.
+********************************************************************************/
+#if (PORT_CLOCK_GATING_API == STD_ON)
+void Port_GatePortClocks( uint8 PortMask );
+#endif
+
+/*******************************************************************************
+* Service Name: Port_UngatePortClocks
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortMask - Ports to restart (bit 0 = PORTA ... bit 5 = PORTF)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Restores the clock of the given ports and returns once they are ready.
+*              The port registers keep their configuration while gated.
+********************************************************************************/
+#if (PORT_CLOCK_GATING_API == STD_ON)
+void Port_UngatePortClocks( uint8 PortMask );
+#endif
 
 /*******************************************************************************
  END OF FILE                                     
@@ -30,7 +30,41 @@
   
 #define PORT_SET_PIN_MODE_API	        (STD_ON)        /* Enable/Disable Port_SetPinMode API */
   
-#define PORT_NUMBER_OF_PORT_PINS        (43U) 		/* Number of port pins in Tiva C */
+#define PORT_PIN_GROUP_API              (STD_ON)        /* Enable/Disable Port_BuildPinSet, Port_SetPinModeGroup and Port_SetPinDirectionGroup APIs */
+
+#define PORT_CONTEXT_API                (STD_ON)        /* Enable/Disable Port_SaveContext and Port_RestoreContext APIs */
+
+#define PORT_CLOCK_GATING_API           (STD_ON)        /* Enable/Disable Port_GatePortClocks and Port_UngatePortClocks APIs */
+
+#define PORT_GATE_UNUSED_PORTS          (STD_ON)        /* Port_Init turns off the clock of ports without configured pins */
+
+#define PORT_NUMBER_OF_PORT_PINS        (39U) 		/* Number of port pins in Tiva C (JTAG pins PC0-PC3 excluded) */
+
+#define PORT_NUMBER_OF_PORTS            (6U) 		/* Number of GPIO ports in Tiva C (PORTA to PORTF) */
+
+#define PORT_NUMBER_OF_CONFIG_SETS      (3U)            /* Post-build configuration sets in Port_PBcfg.c */
+
+/* Configuration set IDs, index of the set in the precompiled images and deltas */
+#define PortConf_NORMAL_CONFIG_SET_ID           (0U)
+#define PortConf_DIAGNOSTIC_CONFIG_SET_ID       (1U)
+#define PortConf_LOW_POWER_CONFIG_SET_ID        (2U)
+
+#define PORT_SWITCH_CONFIG_API          (STD_ON)        /* Enable/Disable Port_SwitchConfig API */
+
+#define PORT_PRECOMPILED_IMAGE          (STD_ON)        /* Port_Init copies the register images generated in Port_PBimage.c */
+
+#define PORT_AHB_APERTURE               (STD_OFF)       /* Port and Dio access the GPIOs through the AHB aperture (single-cycle) */
+
+/* Single-pin register updates through the bit-band alias region: one store per pin instead
+ * of a read-modify-write. Overridable from the command line so the host tests also run
+ * Port_SetPinDirection and Port_SetPinMode through the alias. */
+#ifndef PORT_BIT_BAND_ACCESS
+#define PORT_BIT_BAND_ACCESS            (STD_OFF)
+#endif
+
+#define PORT_DIRECTION_DRIFT_NOTIFICATION (NULL_PTR)     /* Called by Port_RefreshPortDirection for every port with drifted pins */
+
+#define PORT_MAX_UNLOCK_ENTRIES         (2U)            /* Locked pins needing GPIOLOCK/GPIOCR unlocking (PD7 and PF0) */
 
 /* Pin Modes */
 #define PORT_PIN_MODE_ADC               0
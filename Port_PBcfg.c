@@ -36,57 +36,165 @@
 #endif
 /********************************************************************************
  INITIALIZATION FOR ALL PORT PINS
+ PC0 to PC3 are the JTAG pins and are intentionally not part of the tables.
+ Every set lists the same pins in the same order, so a Port Pin ID names the
+ same pin in all the sets. Tools/Port_CfgGen.py compiles these tables into
+ Port_PBimage.c, rerun it after any change to this file.
 *********************************************************************************/
+/* Normal operation */
 const Port_ConfigType PortConfigrations = {
-	/*PORT NUM  , PIN NUM    , DIRECTION   , I.RES  , LVL , PIN MODE	  , DIR CHANGEABILITY  , MODE CHANGEABILITY*/  
-	PORT_PORT_A , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_A , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
+	PortConf_NORMAL_CONFIG_SET_ID,
+	{
+		/*            PORT NUM  , PIN NUM    , DIRECTION   , I.RES  , LVL , PIN MODE	       , DIR CHANGEABILITY  , MODE CHANGEABILITY*/  
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
 																																												   
-	PORT_PORT_B , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_B , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
 																																												   
-	PORT_PORT_C , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_C , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
 																																												   
-	PORT_PORT_D , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_D , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
 																																												   
-	PORT_PORT_E , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_E , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_E , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_E , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_E , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_E , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
 																																												   
-	PORT_PORT_F , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_F , PORT_PIN_1 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_F , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_F , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE,
-	PORT_PORT_F , PORT_PIN_4 , PORT_PIN_IN , PULL_UP, LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_1 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_2 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_3 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_4 , PORT_PIN_IN , PULL_UP, LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE )
+	}
+};
+
+/* Diagnostics: UART0 Rx/Tx on PA0/PA1 (PMC 1) */
+const Port_ConfigType PortConfigDiagnostic = {
+	PortConf_DIAGNOSTIC_CONFIG_SET_ID,
+	{
+		/*            PORT NUM  , PIN NUM    , DIRECTION   , I.RES  , LVL , PIN MODE	       , DIR CHANGEABILITY  , MODE CHANGEABILITY*/  
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_ALT1, DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_1 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_ALT1, DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_6 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_7 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_1 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_2 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_3 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_4 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_5 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_0 , PORT_PIN_IN , OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_1 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_2 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_3 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_4 , PORT_PIN_IN , PULL_UP, LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE )
+	}
+};
+
+/* Low power: unused inputs pulled down instead of floating */
+const Port_ConfigType PortConfigLowPower = {
+	PortConf_LOW_POWER_CONFIG_SET_ID,
+	{
+		/*            PORT NUM  , PIN NUM    , DIRECTION   , I.RES  , LVL , PIN MODE	       , DIR CHANGEABILITY  , MODE CHANGEABILITY*/  
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_0 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_1 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_2 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_3 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_4 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_5 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_6 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_A , PORT_PIN_7 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_0 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_1 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_2 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_3 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_4 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_5 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_6 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_B , PORT_PIN_7 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_4 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_5 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_6 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_C , PORT_PIN_7 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_0 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_1 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_2 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_3 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_4 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_5 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_6 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_D , PORT_PIN_7 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_0 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_1 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_2 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_3 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_4 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_E , PORT_PIN_5 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+																																												   
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_0 , PORT_PIN_IN , PULL_DOWN, LOW, PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_1 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_2 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_3 , PORT_PIN_OUT, OFF    , LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE ),
+		PORT_CFG_PIN( PORT_PORT_F , PORT_PIN_4 , PORT_PIN_IN , PULL_UP, LOW , PORT_PIN_MODE_DIO , DIR_IS_CHANGEABLE  , MODE_IS_CHANGEABLE )
+	}
 };
 /*******************************************************************************
  END OF FILE                                     
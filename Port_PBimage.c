@@ -0,0 +1,151 @@
+/********************************************************************************
+ Module	        : Port
+ File Name	: Port_PBimage.c
+ Author		: Yasser Waleed
+ Description    : Precompiled register images of the post-build configuration sets
+                  and the register deltas between every pair of sets.
+                  GENERATED by Tools/Port_CfgGen.py from Port_PBcfg.c, do not edit.
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Port.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Catch images generated from pin tables of a different size */
+#if ((PORT_NUMBER_OF_PORT_PINS != 39U) || (PORT_NUMBER_OF_CONFIG_SETS != 3U))
+  #error "Port_PBimage.c is out of date, rerun Tools/Port_CfgGen.py"
+#endif
+/********************************************************************************
+ REGISTER IMAGES
+*********************************************************************************/
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+
+const Port_ImageSetType Port_PrecompiledImages[PORT_NUMBER_OF_CONFIG_SETS] = {
+	/* Register images compiled from PortConfigrations (39 pins) */
+	{
+	  0x3F,	/* ClockMask */
+	  2,	/* UnlockCount */
+	  { { 3, 0x80 }, { 5, 0x01 } },	/* Unlock (PORT NUM, COMMIT MASK) */
+	  {
+	    /*PIN MASK, COMMIT, DIR , FIXED, DEN , AMSEL, AFSEL, PUR , PDR , DATA, DR2R, DR4R, DR8R, ODR , SLR , PCTL*/
+	    { 0xFF    , 0x00  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTA */
+	    { 0xFF    , 0x00  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTB */
+	    { 0xF0    , 0x00  , 0x00, 0x00 , 0xF0, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTC */
+	    { 0xFF    , 0x80  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTD */
+	    { 0x3F    , 0x00  , 0x00, 0x00 , 0x3F, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTE */
+	    { 0x1F    , 0x01  , 0x0E, 0x00 , 0x1F, 0x00 , 0x00 , 0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }  /* PORTF */
+	  }
+	},
+
+	/* Register images compiled from PortConfigDiagnostic (39 pins) */
+	{
+	  0x3F,	/* ClockMask */
+	  2,	/* UnlockCount */
+	  { { 3, 0x80 }, { 5, 0x01 } },	/* Unlock (PORT NUM, COMMIT MASK) */
+	  {
+	    /*PIN MASK, COMMIT, DIR , FIXED, DEN , AMSEL, AFSEL, PUR , PDR , DATA, DR2R, DR4R, DR8R, ODR , SLR , PCTL*/
+	    { 0xFF    , 0x00  , 0x02, 0x00 , 0xFF, 0x00 , 0x03 , 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000011U }, /* PORTA */
+	    { 0xFF    , 0x00  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTB */
+	    { 0xF0    , 0x00  , 0x00, 0x00 , 0xF0, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTC */
+	    { 0xFF    , 0x80  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTD */
+	    { 0x3F    , 0x00  , 0x00, 0x00 , 0x3F, 0x00 , 0x00 , 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTE */
+	    { 0x1F    , 0x01  , 0x0E, 0x00 , 0x1F, 0x00 , 0x00 , 0x10, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }  /* PORTF */
+	  }
+	},
+
+	/* Register images compiled from PortConfigLowPower (39 pins) */
+	{
+	  0x3F,	/* ClockMask */
+	  2,	/* UnlockCount */
+	  { { 3, 0x80 }, { 5, 0x01 } },	/* Unlock (PORT NUM, COMMIT MASK) */
+	  {
+	    /*PIN MASK, COMMIT, DIR , FIXED, DEN , AMSEL, AFSEL, PUR , PDR , DATA, DR2R, DR4R, DR8R, ODR , SLR , PCTL*/
+	    { 0xFF    , 0x00  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTA */
+	    { 0xFF    , 0x00  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTB */
+	    { 0xF0    , 0x00  , 0x00, 0x00 , 0xF0, 0x00 , 0x00 , 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTC */
+	    { 0xFF    , 0x80  , 0x00, 0x00 , 0xFF, 0x00 , 0x00 , 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTD */
+	    { 0x3F    , 0x00  , 0x00, 0x00 , 0x3F, 0x00 , 0x00 , 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }, /* PORTE */
+	    { 0x1F    , 0x01  , 0x0E, 0x00 , 0x1F, 0x00 , 0x00 , 0x10, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00000000U }  /* PORTF */
+	  }
+	}
+};
+/********************************************************************************
+ CONFIGURATION SET DELTAS
+*********************************************************************************/
+/* PortConfigrations -> PortConfigDiagnostic */
+static const Port_RegDeltaType Port_Delta_0_1[3] = {
+	/*PORT, REGISTER INDEX                        , MASK       , VALUE*/
+	{ 0   , (PORT_ALT_FUNC_REG_OFFSET >> 2)        , 0x00000003U, 0x00000003U }, /* PORTA AFSEL */
+	{ 0   , (PORT_CTL_REG_OFFSET >> 2)             , 0x00000011U, 0x00000011U }, /* PORTA PCTL */
+	{ 0   , (PORT_DIR_REG_OFFSET >> 2)             , 0x00000002U, 0x00000002U }  /* PORTA DIR */
+};
+
+/* PortConfigrations -> PortConfigLowPower */
+static const Port_RegDeltaType Port_Delta_0_2[6] = {
+	/*PORT, REGISTER INDEX                        , MASK       , VALUE*/
+	{ 0   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x000000FFU }, /* PORTA PDR */
+	{ 1   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x000000FFU }, /* PORTB PDR */
+	{ 2   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000F0U, 0x000000F0U }, /* PORTC PDR */
+	{ 3   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x000000FFU }, /* PORTD PDR */
+	{ 4   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x0000003FU, 0x0000003FU }, /* PORTE PDR */
+	{ 5   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x00000001U, 0x00000001U }  /* PORTF PDR */
+};
+
+/* PortConfigDiagnostic -> PortConfigrations */
+static const Port_RegDeltaType Port_Delta_1_0[3] = {
+	/*PORT, REGISTER INDEX                        , MASK       , VALUE*/
+	{ 0   , (PORT_ALT_FUNC_REG_OFFSET >> 2)        , 0x00000003U, 0x00000000U }, /* PORTA AFSEL */
+	{ 0   , (PORT_CTL_REG_OFFSET >> 2)             , 0x00000011U, 0x00000000U }, /* PORTA PCTL */
+	{ 0   , (PORT_DIR_REG_OFFSET >> 2)             , 0x00000002U, 0x00000000U }  /* PORTA DIR */
+};
+
+/* PortConfigDiagnostic -> PortConfigLowPower */
+static const Port_RegDeltaType Port_Delta_1_2[9] = {
+	/*PORT, REGISTER INDEX                        , MASK       , VALUE*/
+	{ 0   , (PORT_ALT_FUNC_REG_OFFSET >> 2)        , 0x00000003U, 0x00000000U }, /* PORTA AFSEL */
+	{ 0   , (PORT_CTL_REG_OFFSET >> 2)             , 0x00000011U, 0x00000000U }, /* PORTA PCTL */
+	{ 0   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x000000FFU }, /* PORTA PDR */
+	{ 0   , (PORT_DIR_REG_OFFSET >> 2)             , 0x00000002U, 0x00000000U }, /* PORTA DIR */
+	{ 1   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x000000FFU }, /* PORTB PDR */
+	{ 2   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000F0U, 0x000000F0U }, /* PORTC PDR */
+	{ 3   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x000000FFU }, /* PORTD PDR */
+	{ 4   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x0000003FU, 0x0000003FU }, /* PORTE PDR */
+	{ 5   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x00000001U, 0x00000001U }  /* PORTF PDR */
+};
+
+/* PortConfigLowPower -> PortConfigrations */
+static const Port_RegDeltaType Port_Delta_2_0[6] = {
+	/*PORT, REGISTER INDEX                        , MASK       , VALUE*/
+	{ 0   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x00000000U }, /* PORTA PDR */
+	{ 1   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x00000000U }, /* PORTB PDR */
+	{ 2   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000F0U, 0x00000000U }, /* PORTC PDR */
+	{ 3   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x00000000U }, /* PORTD PDR */
+	{ 4   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x0000003FU, 0x00000000U }, /* PORTE PDR */
+	{ 5   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x00000001U, 0x00000000U }  /* PORTF PDR */
+};
+
+/* PortConfigLowPower -> PortConfigDiagnostic */
+static const Port_RegDeltaType Port_Delta_2_1[9] = {
+	/*PORT, REGISTER INDEX                        , MASK       , VALUE*/
+	{ 0   , (PORT_ALT_FUNC_REG_OFFSET >> 2)        , 0x00000003U, 0x00000003U }, /* PORTA AFSEL */
+	{ 0   , (PORT_CTL_REG_OFFSET >> 2)             , 0x00000011U, 0x00000011U }, /* PORTA PCTL */
+	{ 0   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x00000000U }, /* PORTA PDR */
+	{ 0   , (PORT_DIR_REG_OFFSET >> 2)             , 0x00000002U, 0x00000002U }, /* PORTA DIR */
+	{ 1   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x00000000U }, /* PORTB PDR */
+	{ 2   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000F0U, 0x00000000U }, /* PORTC PDR */
+	{ 3   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x000000FFU, 0x00000000U }, /* PORTD PDR */
+	{ 4   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x0000003FU, 0x00000000U }, /* PORTE PDR */
+	{ 5   , (PORT_PULL_DOWN_REG_OFFSET >> 2)       , 0x00000001U, 0x00000000U }  /* PORTF PDR */
+};
+
+const Port_ConfigDeltaType Port_ConfigDeltas[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_CONFIG_SETS] = {
+	{ { 0, NULL_PTR }, { 3, Port_Delta_0_1 }, { 6, Port_Delta_0_2 } },
+	{ { 3, Port_Delta_1_0 }, { 0, NULL_PTR }, { 9, Port_Delta_1_2 } },
+	{ { 6, Port_Delta_2_0 }, { 9, Port_Delta_2_1 }, { 0, NULL_PTR } }
+};
+
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
@@ -0,0 +1,54 @@
+/********************************************************************************
+ Module	        : Ssi_Hw
+ File Name	: Ssi_Hw.c
+ Author		: Yasser Waleed
+ Description    : Source file holding the synchronous serial interface register block table
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Ssi_Hw.h"
+#include "Common_Macros.h"
+/********************************************************************************
+ REGISTER BLOCKS
+*********************************************************************************/
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+
+Ssi_RegsType Ssi_HostRegs[SSI_HW_NUMBER_OF_MODULES];
+volatile uint32 Ssi_HostRcgcSsi = 0;
+
+Ssi_RegsType * const Ssi_ModuleRegs[SSI_HW_NUMBER_OF_MODULES] = {
+	&Ssi_HostRegs[0]
+};
+
+#else
+
+Ssi_RegsType * const Ssi_ModuleRegs[SSI_HW_NUMBER_OF_MODULES] = {
+	(Ssi_RegsType *)SSI0_BASE_ADDRESS
+};
+
+#endif
+/********************************************************************************
+ FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Function Name: Ssi_Hw_EnableSsi
+* Parameters (in): SsiNum - SSI module number (0 = SSI0)
+* Return value: None
+* Description: Enables the run-mode clock of the SSI module, waits for PRSSI to
+*              report it ready and disables the module before it is configured.
+************************************************************************************/
+void Ssi_Hw_EnableSsi(uint8 SsiNum)
+{
+  SSI_HW_RCGCSSI_REG |= (1UL << SsiNum);
+
+  while(BIT_IS_CLEAR(SSI_HW_PRSSI_REG, SsiNum))
+  {
+    /* Wait for the SSI module to be ready */
+  }
+
+  SSI_HW_MODULE(SsiNum)->CR1 &= ~SSI_HW_CR1_SSE;
+}
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
@@ -0,0 +1,82 @@
+/**********************************************************************************
+ Module	     : Ssi_Hw
+ File Name   : Ssi_Hw.h
+ Author	     : Yasser Waleed
+ Description : Synchronous serial interface hardware-access layer. Overlays the
+               TM4C123GH6PM SSI register block with a struct and exposes a
+               const table of the SSI blocks indexed by module.
+***********************************************************************************/
+#ifndef SSI_HW_H
+#define SSI_HW_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "tm4c123gh6pm_registers.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+#define SSI_HW_NUMBER_OF_MODULES        (1U)            /* SSI0 */
+
+/* Register block of the given SSI module */
+#define SSI_HW_MODULE(SsiNum)           (Ssi_ModuleRegs[(SsiNum)])
+
+/* NVIC interrupt number of the SSI module: SSI0 = 7 */
+#define SSI_HW_IRQ(SsiNum)              ((uint8)7U)
+
+/* SSI run-mode clock gating and peripheral ready registers, the host modules are ready at once */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define SSI_HW_RCGCSSI_REG              (Ssi_HostRcgcSsi)
+#define SSI_HW_PRSSI_REG                (Ssi_HostRcgcSsi)
+#else
+#define SSI_HW_RCGCSSI_REG              SYSCTL_RCGCSSI_REG
+#define SSI_HW_PRSSI_REG                SYSCTL_PRSSI_REG
+#endif
+
+/* SSICR0, SSICR1, SSISR and SSIDMACTL bits used by the drivers */
+#define SSI_HW_CR0_DSS_8                (0x7U)          /* 8-bit data, Freescale SPI (FRF = 0) */
+#define SSI_HW_CR0_SPH                  (0x80U)         /* Data captured on the second clock edge, SSInFss stays low between frames */
+#define SSI_HW_CR0_SCR(Scr)             ((uint32)(Scr) << 8)
+#define SSI_HW_CR1_SSE                  (0x2U)          /* SSI enable, master when MS = 0 */
+#define SSI_HW_SR_BSY                   (0x10U)         /* Frame in progress or TX FIFO not empty */
+#define SSI_HW_DMACTL_TXDMAE            (0x2U)          /* TX FIFO requests the uDMA */
+/**********************************************************************************
+ DATA TYPES
+***********************************************************************************/
+/* Overlay of one SSI register block */
+typedef struct
+{
+  volatile uint32 CR0;                  /* 0x000 SSICR0    */
+  volatile uint32 CR1;                  /* 0x004 SSICR1    */
+  volatile uint32 DR;                   /* 0x008 SSIDR     */
+  volatile uint32 SR;                   /* 0x00C SSISR     */
+  volatile uint32 CPSR;                 /* 0x010 SSICPSR   */
+  volatile uint32 IM;                   /* 0x014 SSIIM     */
+  volatile uint32 RIS;                  /* 0x018 SSIRIS    */
+  volatile uint32 MIS;                  /* 0x01C SSIMIS    */
+  volatile uint32 ICR;                  /* 0x020 SSIICR    */
+  volatile uint32 DMACTL;               /* 0x024 SSIDMACTL */
+  volatile uint32 RESERVED0[1000];      /* 0x028-0xFC4     */
+  volatile uint32 CC;                   /* 0xFC8 SSICC     */
+} Ssi_RegsType;
+/**********************************************************************************
+ EXTERNAL VARIABLES
+***********************************************************************************/
+/* Register block of every SSI module, indexed by the module number (0 = SSI0) */
+extern Ssi_RegsType * const Ssi_ModuleRegs[SSI_HW_NUMBER_OF_MODULES];
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/* RAM-backed SSI blocks and clock gating register used by host builds */
+extern Ssi_RegsType Ssi_HostRegs[SSI_HW_NUMBER_OF_MODULES];
+extern volatile uint32 Ssi_HostRcgcSsi;
+#endif
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+/* Clocks the SSI module, waits until it is ready and disables it for configuration */
+void Ssi_Hw_EnableSsi(uint8 SsiNum);
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
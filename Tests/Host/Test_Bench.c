@@ -0,0 +1,93 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_Bench.c
+ Author	     : Yasser Waleed
+ Description : Runs the driver benchmarks on the host register model and prints
+               their rates. The host clock says nothing about target cycles, so
+               the checks count the GPIO register accesses of every loop: the
+               pre-resolution channel write is a GPIODATA read and a write, the
+               resolved one a single store, and a pin toggle is one store in
+               either aperture, the GPIOHBCTL setting being restored after it.
+               The parallel bus burst must leave its last byte on the bus.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Bench.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+static void Test_Print(const char * Name, const Bench_ResultType * Result)
+{
+  printf("%-24s %8lu ops %8lu ticks %12lu /s\n", Name, (unsigned long)Result->Count,
+         (unsigned long)Result->Ticks, (unsigned long)Result->PerSecond);
+}
+
+static void Test_DioWriteChannel(void)
+{
+  Bench_ResultType Legacy;
+  Bench_ResultType Resolved;
+
+  Gpio_HostResetCounters();
+  Bench_DioWriteChannel(&Legacy, &Resolved);
+
+  TEST_CHECK_EQUAL(Legacy.Count, BENCH_ITERATIONS);
+  TEST_CHECK_EQUAL(Resolved.Count, BENCH_ITERATIONS);
+
+  /* Legacy: one read and one write per call, resolved: one write per call */
+  TEST_CHECK_EQUAL(Gpio_HostAccessCount(), 3U * BENCH_ITERATIONS);
+  Test_Print("Legacy Dio_WriteChannel", &Legacy);
+  Test_Print("Dio_WriteChannel", &Resolved);
+}
+
+static void Test_Toggle(void)
+{
+  Bench_ResultType Apb;
+  Bench_ResultType Ahb;
+  uint32 Hbctl = Gpio_HostHbctl;
+
+  Gpio_HostResetCounters();
+  Bench_Toggle(&Apb, &Ahb);
+
+  TEST_CHECK_EQUAL(Apb.Count, BENCH_ITERATIONS);
+  TEST_CHECK_EQUAL(Ahb.Count, BENCH_ITERATIONS);
+
+  /* One store per toggle in each aperture, GPIOHBCTL read once and written for APB, AHB and back */
+  TEST_CHECK_EQUAL(Gpio_HostAccessCount(), (2U * BENCH_ITERATIONS) + 4U);
+  TEST_CHECK_EQUAL(Gpio_HostSysReads, 1U);
+  TEST_CHECK_EQUAL(Gpio_HostSysWrites, 3U);
+  TEST_CHECK_EQUAL(Gpio_HostHbctl, Hbctl);
+  TEST_CHECK_EQUAL(Gpio_HostData[DioConf_LED1_PORT_NUM] & (1U << DioConf_LED1_CHANNEL_NUM), 0U);
+  Test_Print("Toggle (APB)", &Apb);
+  Test_Print("Toggle (AHB)", &Ahb);
+}
+
+static void Test_PbusWrite(void)
+{
+  Bench_ResultType PbusWrite;
+
+  Test_ClearDet();
+  TEST_CHECK_EQUAL(Bench_PbusWrite(&PbusWrite), E_OK);
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+  TEST_CHECK_EQUAL(PbusWrite.Count, BENCH_PBUS_BURSTS * BENCH_PBUS_BURST_LENGTH);
+  TEST_CHECK_EQUAL(Gpio_HostData[PbusConf_DATA_PORT_NUM] & PbusConf_DATA_MASK,
+                   (uint8)(BENCH_PBUS_BURST_LENGTH - 1U) & PbusConf_DATA_MASK);
+  Test_Print("Pbus_Write bytes", &PbusWrite);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+  Bench_Init();
+
+  Test_DioWriteChannel();
+  Test_Toggle();
+  Test_PbusWrite();
+  return TEST_REPORT("Test_Bench");
+}
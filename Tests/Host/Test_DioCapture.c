@@ -0,0 +1,140 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_DioCapture.c
+ Author	     : Yasser Waleed
+ Description : Runs the Dio capture on the host models: every sample period the
+               scripted input levels of the port step, TIMER0A requests uDMA
+               channel 18, and the completion of a buffer half runs
+               Timer0A_Handler. Checks that peek and commit return the samples
+               in order across the end of the ring buffer, that commit is
+               clamped to what peek returns, and that an overrun drops the
+               unconsumed samples and restarts from the newest one.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Gpio_Hw.h"
+#include "Udma.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_PORT_ID                    DioConf_PORTB_PORT_ID_INDEX
+#define TEST_PORT_NUM                   DioConf_PORTB_PORT_NUM
+
+#define TEST_BUFFER_SIZE                (8U)            /* Two halves of 4 samples */
+#define TEST_SCRIPT_LENGTH              (64U)
+/**********************************************************************************
+ LOCAL VARIABLES
+***********************************************************************************/
+static uint8 Test_Buffer[TEST_BUFFER_SIZE];
+static uint8 Test_Script[TEST_SCRIPT_LENGTH];
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+/* Sample periods of the capture timer: new input level, one uDMA request, the ISR on a full half */
+static void Test_Sample(uint16 Periods)
+{
+  for (uint16 period = 0; period < Periods; period++)
+  {
+    Gpio_HostStepInputScript();
+    if(Udma_HostRequest(UDMA_CH18_TIMER0A))
+    {
+      Timer0A_Handler();
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+}
+
+/* Peeks and checks that the samples are First, First + 1 ... */
+static void Test_Peek(Std_ReturnType Result, uint16 Count, uint8 First)
+{
+  const uint8 * samples = NULL_PTR;
+  uint16 count = 0xFFFFU;
+
+  TEST_CHECK_EQUAL(Dio_CapturePeek(&samples, &count), Result);
+  TEST_CHECK_EQUAL(count, Count);
+  for (uint16 index = 0; (samples != NULL_PTR) && (index < count); index++)
+  {
+    TEST_CHECK_EQUAL(samples[index], (uint8)(First + index));
+  }
+}
+
+static void Test_CommitWithoutCapture(void)
+{
+  Test_ClearDet();
+  Dio_CaptureCommit(3U);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+  TEST_CHECK_EQUAL(Test_DetCount, 1U);
+  TEST_CHECK_EQUAL(Test_DetError, DIO_E_CAPTURE_STATE);
+#endif
+}
+
+static void Test_PeekCommitWrap(void)
+{
+  Test_ClearDet();
+  TEST_CHECK_EQUAL(Dio_CaptureStart(TEST_PORT_ID, Test_Buffer, TEST_BUFFER_SIZE, 100U), E_OK);
+  Test_Peek(E_OK, 0U, 0U);
+
+  /* Samples 1..3 in the first half */
+  Test_Sample(3U);
+  Test_Peek(E_OK, 3U, 1U);
+  Dio_CaptureCommit(2U);
+  Test_Peek(E_OK, 1U, 3U);
+
+  /* More than peeked is clamped to the one sample left */
+  Dio_CaptureCommit(10U);
+  Test_Peek(E_OK, 0U, 0U);
+
+  /* Samples 4..9: 4..8 up to the end of the buffer, then 9 from its start */
+  Test_Sample(6U);
+  Test_Peek(E_OK, 5U, 4U);
+  Dio_CaptureCommit(5U);
+  Test_Peek(E_OK, 1U, 9U);
+  Dio_CaptureCommit(1U);
+  Test_Peek(E_OK, 0U, 0U);
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+}
+
+static void Test_Overrun(void)
+{
+  /* Samples 10..21, more than the buffer holds: 10..13 were overwritten */
+  Test_Sample(12U);
+
+  /* A commit in the overrun gives nothing back, peek still sees the overrun */
+  Dio_CaptureCommit(4U);
+  Test_Peek(E_NOT_OK, 0U, 0U);
+
+  /* Restarted after the newest sample */
+  Test_Peek(E_OK, 0U, 0U);
+  Test_Sample(2U);
+  Test_Peek(E_OK, 2U, 22U);
+  Dio_CaptureCommit(2U);
+
+  Dio_CaptureStop();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  for (uint16 step = 0; step < TEST_SCRIPT_LENGTH; step++)
+  {
+    Test_Script[step] = (uint8)(step + 1U);
+  }
+
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+  Gpio_HostLoadInputScript(TEST_PORT_NUM, Test_Script, TEST_SCRIPT_LENGTH);
+
+  Test_CommitWithoutCapture();
+  Test_PeekCommitWrap();
+  Test_Overrun();
+  return TEST_REPORT("Test_DioCapture");
+}
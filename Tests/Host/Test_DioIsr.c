@@ -0,0 +1,115 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_DioIsr.c
+ Author	     : Yasser Waleed
+ Description : Checks the GPIO port interrupt dispatch of Dio on the host model:
+               the test sets GPIOMIS and calls the GPIOPortx_Handler functions
+               as the NVIC would. Every handler acknowledges the pending pins of
+               its own port only, and the notification runs once per interrupt
+               in which its pin is pending, never for other pins or ports.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_SW1_PORT                   DioConf_SW1_PORT_NUM
+#define TEST_SW1_PIN                    (uint8)(1U << DioConf_SW1_CHANNEL_NUM)
+/**********************************************************************************
+ LOCAL VARIABLES
+***********************************************************************************/
+/* Port interrupt vectors, indexed by hardware port */
+static void (* const Test_Handlers[GPIO_HW_NUMBER_OF_PORTS])(void) = {
+  GPIOPortA_Handler, GPIOPortB_Handler, GPIOPortC_Handler,
+  GPIOPortD_Handler, GPIOPortE_Handler, GPIOPortF_Handler
+};
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+/* Raises the interrupt of Port with the given pending pins */
+static void Test_Interrupt(uint8 Port, uint8 Pending)
+{
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    Gpio_HostRegs[port].ICR = 0;
+  }
+  Gpio_HostRegs[Port].MIS = Pending;
+  Test_Handlers[Port]();
+  Gpio_HostRegs[Port].MIS = 0;
+}
+
+static void Test_EdgeConfiguration(void)
+{
+  /* Both edges of SW1, masked until Dio_EnableNotification */
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].IS & TEST_SW1_PIN, 0U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].IBE & TEST_SW1_PIN, TEST_SW1_PIN);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].IM & TEST_SW1_PIN, 0U);
+
+  Dio_EnableNotification(DioConf_SW1_CHANNEL_ID_INDEX);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].IM & TEST_SW1_PIN, TEST_SW1_PIN);
+}
+
+static void Test_Dispatch(void)
+{
+  Test_ButtonNotifications = 0;
+
+  /* SW1 alone */
+  Test_Interrupt(TEST_SW1_PORT, TEST_SW1_PIN);
+  TEST_CHECK_EQUAL(Test_ButtonNotifications, 1U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].ICR, TEST_SW1_PIN);
+
+  /* A pin without notification is acknowledged, nothing is called */
+  Test_Interrupt(TEST_SW1_PORT, 0x01U);
+  TEST_CHECK_EQUAL(Test_ButtonNotifications, 1U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].ICR, 0x01U);
+
+  /* Both pending in one interrupt: one call, both acknowledged */
+  Test_Interrupt(TEST_SW1_PORT, (uint8)(TEST_SW1_PIN | 0x01U));
+  TEST_CHECK_EQUAL(Test_ButtonNotifications, 2U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_SW1_PORT].ICR, TEST_SW1_PIN | 0x01U);
+
+  /* Spurious interrupt, nothing pending */
+  Test_Interrupt(TEST_SW1_PORT, 0U);
+  TEST_CHECK_EQUAL(Test_ButtonNotifications, 2U);
+
+  /* Only the masked status counts, a raw edge of a masked pin is ignored */
+  Gpio_HostRegs[TEST_SW1_PORT].RIS = TEST_SW1_PIN;
+  Test_Interrupt(TEST_SW1_PORT, 0U);
+  Gpio_HostRegs[TEST_SW1_PORT].RIS = 0;
+  TEST_CHECK_EQUAL(Test_ButtonNotifications, 2U);
+}
+
+static void Test_OtherPorts(void)
+{
+  Test_ButtonNotifications = 0;
+
+  /* Every handler serves its own port: the SW1 pin number on another port is not SW1 */
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    Test_Interrupt(port, 0xFFU);
+    for (uint8 other = 0; other < GPIO_HW_NUMBER_OF_PORTS; other++)
+    {
+      TEST_CHECK_EQUAL(Gpio_HostRegs[other].ICR, (other == port) ? 0xFFU : 0U);
+    }
+  }
+  TEST_CHECK_EQUAL(Test_ButtonNotifications, 1U);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+
+  Test_EdgeConfiguration();
+  Test_Dispatch();
+  Test_OtherPorts();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+  return TEST_REPORT("Test_DioIsr");
+}
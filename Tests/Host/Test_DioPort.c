@@ -0,0 +1,196 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_DioPort.c
+ Author	     : Yasser Waleed
+ Description : Checks the Dio port services against the GPIODATA address masking
+               of the host register model: the port write is one all-pins store,
+               the masked write changes only the masked pins with one store and
+               no read, and the port read returns the levels of all the pins.
+               The channel read follows direction changes made through Port.
+               A channel flip reaches the pin, with or without the output shadow.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_PORT_ID                    DioConf_PORTB_PORT_ID_INDEX
+#define TEST_PORT_NUM                   DioConf_PORTB_PORT_NUM
+
+#define TEST_LED1_PIN_ID                (Port_PinType)35U  /* PF1 in Port_PBcfg.c */
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+/* Reads and writes of the GPIODATA words of the test port */
+static uint32 Test_DataReads(void)
+{
+  uint32 count = 0;
+
+  for (uint16 word = 0; word < GPIO_HW_DATA_WORDS; word++)
+  {
+    count += Gpio_HostReads[TEST_PORT_NUM][word];
+  }
+  return count;
+}
+
+static uint32 Test_DataWrites(void)
+{
+  uint32 count = 0;
+
+  for (uint16 word = 0; word < GPIO_HW_DATA_WORDS; word++)
+  {
+    count += Gpio_HostWrites[TEST_PORT_NUM][word];
+  }
+  return count;
+}
+
+static void Test_DataMasking(void)
+{
+  Gpio_RegsType * Regs = GPIO_HW_PORT(TEST_PORT_NUM);
+
+  /* All the GPIODATA addresses share one data word */
+  Gpio_HostData[TEST_PORT_NUM] = 0x5A;
+  TEST_CHECK_EQUAL(GPIO_HW_READ(Regs->DATA[GPIO_HW_DATA_ALL_PINS]), 0x5AU);
+  TEST_CHECK_EQUAL(GPIO_HW_READ(Regs->DATA[0x0F]), 0x0AU);
+  TEST_CHECK_EQUAL(GPIO_HW_READ(Regs->DATA[0x00]), 0x00U);
+
+  GPIO_HW_WRITE(Regs->DATA[0x03], 0xFF);
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM], 0x5BU);
+  GPIO_HW_WRITE(Regs->DATA[0x00], 0x00);
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM], 0x5BU);
+}
+
+static void Test_WritePort(void)
+{
+  Gpio_HostData[TEST_PORT_NUM] = 0x00;
+  Gpio_HostResetCounters();
+
+  Dio_WritePort(TEST_PORT_ID, 0xA5);
+
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM], 0xA5U);
+  TEST_CHECK_EQUAL(Gpio_HostWrites[TEST_PORT_NUM][GPIO_HW_DATA_ALL_PINS], 1U);
+  TEST_CHECK_EQUAL(Test_DataWrites(), 1U);
+  TEST_CHECK_EQUAL(Test_DataReads(), 0U);
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  TEST_CHECK_EQUAL(Dio_OutputShadow[TEST_PORT_NUM], 0xA5U);
+#endif
+}
+
+static void Test_MaskedWritePort(void)
+{
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+  Gpio_HostData[TEST_PORT_NUM] = 0xF0;
+  Gpio_HostResetCounters();
+
+  /* Only the low nibble is written, the high one keeps its levels */
+  Dio_MaskedWritePort(TEST_PORT_ID, 0xFF, 0x0F);
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM], 0xFFU);
+  TEST_CHECK_EQUAL(Gpio_HostWrites[TEST_PORT_NUM][0x0F], 1U);
+
+  Dio_MaskedWritePort(TEST_PORT_ID, 0x00, 0x81);
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM], 0x7EU);
+  TEST_CHECK_EQUAL(Gpio_HostWrites[TEST_PORT_NUM][0x81], 1U);
+
+  /* Level bits outside the mask are ignored */
+  Dio_MaskedWritePort(TEST_PORT_ID, 0x81, 0x01);
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM], 0x7FU);
+
+  /* One store per call and no read-modify-write */
+  TEST_CHECK_EQUAL(Test_DataWrites(), 3U);
+  TEST_CHECK_EQUAL(Test_DataReads(), 0U);
+#endif
+}
+
+static void Test_ReadPort(void)
+{
+  Gpio_HostData[TEST_PORT_NUM] = 0x3C;
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+  /* Port reads are served from the levels latched for the tick */
+  Dio_LatchInputs();
+  Gpio_HostData[TEST_PORT_NUM] = 0x00;
+#endif
+  TEST_CHECK_EQUAL(Dio_ReadPort(TEST_PORT_ID), 0x3CU);
+
+  Gpio_HostData[TEST_PORT_NUM] = 0xC3;
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+  Dio_LatchInputs();
+#endif
+  TEST_CHECK_EQUAL(Dio_ReadPort(TEST_PORT_ID), 0xC3U);
+}
+
+static void Test_ReadChannelDirection(void)
+{
+  Dio_PortType port = DioConf_LED1_PORT_NUM;
+  uint8 pin = (uint8)(1U << DioConf_LED1_CHANNEL_NUM);
+
+  Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+  Gpio_HostData[port] &= ~(uint32)pin;
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  /* Output channel: the commanded level, not the pin, and no GPIODIR read */
+  Gpio_HostResetCounters();
+  TEST_CHECK_EQUAL(Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX), STD_HIGH);
+  TEST_CHECK_EQUAL(Gpio_HostAccessCount(), 0U);
+#endif
+
+  /* Once Port turns it into an input, the pin level is returned */
+  Port_SetPinDirection(TEST_LED1_PIN_ID, PORT_PIN_IN);
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+  Dio_SyncDirections();
+#endif
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+  Dio_LatchInputs();
+#endif
+  TEST_CHECK_EQUAL(Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX), STD_LOW);
+
+  Port_SetPinDirection(TEST_LED1_PIN_ID, PORT_PIN_OUT);
+#if (DIO_SYNC_DIRECTIONS_API == STD_ON)
+  Dio_SyncDirections();
+#endif
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  /* The pin rejoins the shadow with the level it has now */
+  TEST_CHECK_EQUAL(Dio_OutputShadow[port] & pin, 0U);
+#endif
+}
+static void Test_FlipChannel(void)
+{
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+  Dio_PortType port = DioConf_LED1_PORT_NUM;
+  uint8 pin = (uint8)(1U << DioConf_LED1_CHANNEL_NUM);
+
+  Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+  TEST_CHECK_EQUAL(Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX), STD_HIGH);
+  TEST_CHECK_EQUAL(Gpio_HostData[port] & pin, pin);
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  TEST_CHECK_EQUAL(Dio_OutputShadow[port] & pin, pin);
+#endif
+
+  TEST_CHECK_EQUAL(Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX), STD_LOW);
+  TEST_CHECK_EQUAL(Gpio_HostData[port] & pin, 0U);
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  TEST_CHECK_EQUAL(Dio_OutputShadow[port] & pin, 0U);
+#endif
+#endif
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+
+  Test_DataMasking();
+  Test_WritePort();
+  Test_MaskedWritePort();
+  Test_ReadPort();
+  Test_ReadChannelDirection();
+  Test_FlipChannel();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+
+  return TEST_REPORT("Test_DioPort");
+}
@@ -0,0 +1,152 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_DioQueue.c
+ Author	     : Yasser Waleed
+ Description : Runs the Dio output queue on the host Gptm model: the test moves
+               TIMER2A TAV and calls Timer2A_Handler as the match interrupt
+               would. Checks that timed writes are committed in time order
+               whatever the queuing order, that writes for the same time keep
+               their queuing order, that the order holds across the wrap of
+               TAV, and that the match is armed on the first pending write.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Gpio_Hw.h"
+#include "Gptm_Hw.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_PORT_ID                    DioConf_PORTF_PORT_ID_INDEX
+#define TEST_PORT_NUM                   DioConf_PORTF_PORT_NUM
+
+/* PF1..PF3, outputs in every configuration set */
+#define TEST_PIN_A                      (0x02U)
+#define TEST_PIN_B                      (0x04U)
+#define TEST_PIN_C                      (0x08U)
+#define TEST_PINS                       (TEST_PIN_A | TEST_PIN_B | TEST_PIN_C)
+
+#define TEST_QUEUE_TIMER                (2U)            /* DIO_QUEUE_TIMER */
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+static uint32 Test_Pins(void)
+{
+  return Gpio_HostData[TEST_PORT_NUM] & TEST_PINS;
+}
+
+static boolean Test_MatchArmed(void)
+{
+  return (Gptm_HostRegs[TEST_QUEUE_TIMER].IMR & GPTM_HW_INT_TAM) ? TRUE : FALSE;
+}
+
+/* The time base reaches Time and the match interrupt runs */
+static void Test_RunTo(uint32 Time)
+{
+  Gptm_HostRegs[TEST_QUEUE_TIMER].TAV = Time;
+  Timer2A_Handler();
+}
+
+static void Test_Start(uint32 Now)
+{
+  Dio_ClearQueue();
+  Dio_WritePort(TEST_PORT_ID, 0);
+  Gptm_HostRegs[TEST_QUEUE_TIMER].TAV = Now;
+}
+
+static void Test_SortedInsert(void)
+{
+  Test_Start(1000U);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(1300U, TEST_PORT_ID, TEST_PIN_C, TEST_PIN_C), E_OK);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(1100U, TEST_PORT_ID, TEST_PIN_A, TEST_PIN_A), E_OK);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(1200U, TEST_PORT_ID, TEST_PIN_B, TEST_PIN_B), E_OK);
+  TEST_CHECK_EQUAL(Gptm_HostRegs[TEST_QUEUE_TIMER].TAMATCHR, 1100U);
+  TEST_CHECK_EQUAL(Test_MatchArmed(), TRUE);
+  TEST_CHECK_EQUAL(Test_Pins(), 0U);
+
+  Test_RunTo(1150U);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_A);
+  TEST_CHECK_EQUAL(Gptm_HostRegs[TEST_QUEUE_TIMER].TAMATCHR, 1200U);
+
+  Test_RunTo(1250U);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_A | TEST_PIN_B);
+  TEST_CHECK_EQUAL(Gptm_HostRegs[TEST_QUEUE_TIMER].TAMATCHR, 1300U);
+
+  Test_RunTo(1300U);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PINS);
+  TEST_CHECK_EQUAL(Test_MatchArmed(), FALSE);
+}
+
+static void Test_SameTimeFifo(void)
+{
+  Test_Start(2000U);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(2200U, TEST_PORT_ID, TEST_PIN_A, 0U), E_OK);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(2100U, TEST_PORT_ID, TEST_PIN_A, TEST_PIN_A), E_OK);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(2200U, TEST_PORT_ID, TEST_PIN_A, TEST_PIN_A), E_OK);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(2100U, TEST_PORT_ID, TEST_PIN_A, 0U), E_OK);
+
+  /* The last write queued for a time is the one left on the pin */
+  Test_RunTo(2150U);
+  TEST_CHECK_EQUAL(Test_Pins(), 0U);
+  Test_RunTo(2250U);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_A);
+  TEST_CHECK_EQUAL(Test_MatchArmed(), FALSE);
+}
+
+static void Test_TimeBaseWrap(void)
+{
+  Test_Start(0xFFFFFF00UL);
+  /* 0x10 is after the wrap, so it goes behind 0xFFFFFF80 */
+  TEST_CHECK_EQUAL(Dio_QueueWrite(0x00000010UL, TEST_PORT_ID, TEST_PIN_B, TEST_PIN_B), E_OK);
+  TEST_CHECK_EQUAL(Dio_QueueWrite(0xFFFFFF80UL, TEST_PORT_ID, TEST_PIN_A, TEST_PIN_A), E_OK);
+  TEST_CHECK_EQUAL(Gptm_HostRegs[TEST_QUEUE_TIMER].TAMATCHR, 0xFFFFFF80UL);
+
+  Test_RunTo(0xFFFFFFA0UL);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_A);
+  TEST_CHECK_EQUAL(Gptm_HostRegs[TEST_QUEUE_TIMER].TAMATCHR, 0x00000010UL);
+  TEST_CHECK_EQUAL(Test_MatchArmed(), TRUE);
+
+  Test_RunTo(0x00000020UL);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_A | TEST_PIN_B);
+  TEST_CHECK_EQUAL(Test_MatchArmed(), FALSE);
+}
+
+static void Test_DueAndFull(void)
+{
+  Test_Start(3000U);
+
+  /* Already due when queued: committed at once, nothing armed */
+  TEST_CHECK_EQUAL(Dio_QueueWrite(3000U, TEST_PORT_ID, TEST_PIN_C, TEST_PIN_C), E_OK);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_C);
+  TEST_CHECK_EQUAL(Test_MatchArmed(), FALSE);
+
+  for (uint32 entry = 0; entry < DIO_OUTPUT_QUEUE_SIZE; entry++)
+  {
+    TEST_CHECK_EQUAL(Dio_QueueWrite(4000U + entry, TEST_PORT_ID, TEST_PIN_A, TEST_PIN_A), E_OK);
+  }
+  TEST_CHECK_EQUAL(Dio_QueueWrite(5000U, TEST_PORT_ID, TEST_PIN_A, TEST_PIN_A), E_NOT_OK);
+
+  /* Dropped writes are never committed */
+  Dio_ClearQueue();
+  TEST_CHECK_EQUAL(Test_MatchArmed(), FALSE);
+  Test_RunTo(6000U);
+  TEST_CHECK_EQUAL(Test_Pins(), TEST_PIN_C);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+
+  Test_SortedInsert();
+  Test_SameTimeFifo();
+  Test_TimeBaseWrap();
+  Test_DueAndFull();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+  return TEST_REPORT("Test_DioQueue");
+}
@@ -0,0 +1,172 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_DioWaveform.c
+ Author	     : Yasser Waleed
+ Description : Runs the Dio waveform on the host models: every sample period
+               TIMER1A requests uDMA channel 20, and the completion of a buffer
+               runs Timer1A_Handler. Checks the pin levels of the one-shot, loop
+               and stream modes, the buffers handed to the notification, that
+               only the masked pins are driven, and that a stopped waveform
+               leaves the pins at their last level.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Gpio_Hw.h"
+#include "Udma.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_PORT_ID                    DioConf_PORTF_PORT_ID_INDEX
+#define TEST_PORT_NUM                   DioConf_PORTF_PORT_NUM
+
+#define TEST_PIN                        (0x02U)         /* PF1, driven by the waveform */
+#define TEST_OTHER_PIN                  (0x04U)         /* PF2, an output left to Dio */
+
+#define TEST_MAX_NOTIFICATIONS          (8U)
+/**********************************************************************************
+ LOCAL VARIABLES
+***********************************************************************************/
+static uint8 * Test_Notified[TEST_MAX_NOTIFICATIONS];
+static uint8 Test_NotifyCount = 0;
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+static void Test_Notification(uint8 * Buffer)
+{
+  if(Test_NotifyCount < TEST_MAX_NOTIFICATIONS)
+  {
+    Test_Notified[Test_NotifyCount] = Buffer;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  Test_NotifyCount++;
+}
+
+/* One sample period: one uDMA request, the ISR on a completed buffer */
+static void Test_Sample(void)
+{
+  if(Udma_HostRequest(UDMA_CH20_TIMER1A))
+  {
+    Timer1A_Handler();
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+}
+
+/* Plays Count samples and checks the driven pin after each of them */
+static void Test_Play(const uint8 * Expected, uint16 Count)
+{
+  for (uint16 sample = 0; sample < Count; sample++)
+  {
+    Test_Sample();
+    TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM] & TEST_PIN, Expected[sample]);
+  }
+}
+
+static void Test_Reset(void)
+{
+  Dio_WritePort(TEST_PORT_ID, TEST_OTHER_PIN);
+  Test_NotifyCount = 0;
+  Test_ClearDet();
+}
+
+static void Test_OneShot(void)
+{
+  static uint8 Buffer[3] = { TEST_PIN, 0U, TEST_PIN | TEST_OTHER_PIN };
+  static const uint8 Expected[5] = { TEST_PIN, 0U, TEST_PIN, TEST_PIN, TEST_PIN };
+
+  Test_Reset();
+  TEST_CHECK_EQUAL(Dio_WaveformStart(TEST_PORT_ID, TEST_PIN, DIO_WAVEFORM_ONE_SHOT, Buffer, NULL_PTR,
+                                     3U, 100U, Test_Notification), E_OK);
+
+  /* Played once, then the pin keeps the last value */
+  Test_Play(Expected, 5U);
+  TEST_CHECK_EQUAL(Test_NotifyCount, 1U);
+  TEST_CHECK(Test_Notified[0] == Buffer);
+
+  /* The mask keeps the waveform off the other pins */
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM] & TEST_OTHER_PIN, TEST_OTHER_PIN);
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  /* The pin is handed back to the shadow at the level it was left at */
+  TEST_CHECK_EQUAL(Dio_OutputShadow[TEST_PORT_NUM] & TEST_PIN, TEST_PIN);
+#endif
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+}
+
+static void Test_Loop(void)
+{
+  static uint8 Buffer[2] = { TEST_PIN, 0U };
+  static const uint8 Expected[6] = { TEST_PIN, 0U, TEST_PIN, 0U, TEST_PIN, 0U };
+
+  Test_Reset();
+  TEST_CHECK_EQUAL(Dio_WaveformStart(TEST_PORT_ID, TEST_PIN, DIO_WAVEFORM_LOOP, Buffer, NULL_PTR,
+                                     2U, 100U, Test_Notification), E_OK);
+  Test_Play(Expected, 6U);
+
+  /* Every pass over the buffer is notified */
+  TEST_CHECK_EQUAL(Test_NotifyCount, 3U);
+  for (uint8 pass = 0; pass < 3U; pass++)
+  {
+    TEST_CHECK(Test_Notified[pass] == Buffer);
+  }
+
+  /* A second waveform is refused while this one plays */
+  TEST_CHECK_EQUAL(Dio_WaveformStart(TEST_PORT_ID, TEST_PIN, DIO_WAVEFORM_LOOP, Buffer, NULL_PTR,
+                                     2U, 100U, NULL_PTR), E_NOT_OK);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+  TEST_CHECK_EQUAL(Test_DetError, DIO_E_WAVEFORM_STATE);
+#endif
+
+  /* Stopped after a 1: no more requests reach the pin */
+  Test_Sample();
+  Dio_WaveformStop();
+  Test_Sample();
+  Test_Sample();
+  TEST_CHECK_EQUAL(Gpio_HostData[TEST_PORT_NUM] & TEST_PIN, TEST_PIN);
+  TEST_CHECK_EQUAL(Test_NotifyCount, 3U);
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+  TEST_CHECK_EQUAL(Dio_OutputShadow[TEST_PORT_NUM] & TEST_PIN, TEST_PIN);
+#endif
+}
+
+static void Test_Stream(void)
+{
+  static uint8 Buffer0[2] = { TEST_PIN, TEST_PIN };
+  static uint8 Buffer1[2] = { 0U, 0U };
+  static const uint8 Expected[6] = { TEST_PIN, TEST_PIN, 0U, 0U, TEST_PIN, TEST_PIN };
+
+  Test_Reset();
+  TEST_CHECK_EQUAL(Dio_WaveformStart(TEST_PORT_ID, TEST_PIN, DIO_WAVEFORM_STREAM, Buffer0, Buffer1,
+                                     2U, 100U, Test_Notification), E_OK);
+  Test_Play(Expected, 6U);
+
+  /* The buffers are handed back in the order they were played */
+  TEST_CHECK_EQUAL(Test_NotifyCount, 3U);
+  TEST_CHECK(Test_Notified[0] == Buffer0);
+  TEST_CHECK(Test_Notified[1] == Buffer1);
+  TEST_CHECK(Test_Notified[2] == Buffer0);
+
+  Dio_WaveformStop();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+
+  Test_OneShot();
+  Test_Loop();
+  Test_Stream();
+  return TEST_REPORT("Test_DioWaveform");
+}
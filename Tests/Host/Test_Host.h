@@ -0,0 +1,67 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_Host.h
+ Author	     : Yasser Waleed
+ Description : Checks shared by the host tests. The tests link the drivers built
+               with GPIO_HW_HOST_MODEL = STD_ON against the RAM-backed register
+               model of Gpio_Hw.c, see Tests/Host/run_host_tests.sh.
+***********************************************************************************/
+#ifndef TEST_HOST_H
+#define TEST_HOST_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include <stddef.h>
+#include <stdio.h>
+#include "Std_Types.h"
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+/* Records a failed check with its location, the test goes on with the next check */
+#define TEST_CHECK(Cond)                                                  \
+  do {                                                                    \
+    Test_Checks++;                                                        \
+    if(!(Cond))                                                           \
+    {                                                                     \
+      Test_Failures++;                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Cond);     \
+    }                                                                     \
+  } while(0)
+
+#define TEST_CHECK_EQUAL(Actual, Expected)                                \
+  do {                                                                    \
+    unsigned long test_actual   = (unsigned long)(Actual);                \
+    unsigned long test_expected = (unsigned long)(Expected);              \
+    Test_Checks++;                                                        \
+    if(test_actual != test_expected)                                      \
+    {                                                                     \
+      Test_Failures++;                                                    \
+      printf("%s:%d: %s is 0x%lX, expected 0x%lX\n", __FILE__, __LINE__,  \
+             #Actual, test_actual, test_expected);                        \
+    }                                                                     \
+  } while(0)
+
+/* Exit status of the test program: 0 when every check passed */
+#define TEST_REPORT(Name)                                                 \
+  (printf("%s: %lu checks, %lu failed\n", (Name), Test_Checks, Test_Failures), \
+   (Test_Failures == 0UL) ? 0 : 1)
+/**********************************************************************************
+ GLOBAL DATA
+***********************************************************************************/
+extern unsigned long Test_Checks;
+extern unsigned long Test_Failures;
+
+/* Last error reported to the Det stub, cleared by Test_ClearDet */
+extern uint16 Test_DetModule;
+extern uint8  Test_DetApi;
+extern uint8  Test_DetError;
+extern uint32 Test_DetCount;
+
+/* Calls of the SW1 edge notification stub */
+extern uint32 Test_ButtonNotifications;
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+void Test_ClearDet(void);
+
+#endif /* TEST_HOST_H */
@@ -0,0 +1,79 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_Led.c
+ Author	     : Yasser Waleed
+ Description : Runs the LED tasks in the order of one Os_Scheduler tick: the inputs
+               are latched first, App_Task toggles the LED and Led_Task refreshes
+               it. The refresh must keep the toggled level, so the Dio reads of
+               an output channel, port or group return the level written in the
+               tick and not the one latched at its start.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Led.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_LED1_PIN                   (uint8)(1U << DioConf_LED1_CHANNEL_NUM)
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+/* Start of an Os_Scheduler tick */
+static void Test_Tick(void)
+{
+#if (DIO_INPUT_SNAPSHOT == STD_ON)
+  Dio_LatchInputs();
+#endif
+}
+
+static void Test_ToggleThenRefresh(void)
+{
+  LED_setOff();
+
+  Test_Tick();
+  LED_toggle();
+  LED_refreshOutput();
+  TEST_CHECK_EQUAL(Gpio_HostData[DioConf_LED1_PORT_NUM] & TEST_LED1_PIN, TEST_LED1_PIN);
+
+  Test_Tick();
+  LED_toggle();
+  LED_refreshOutput();
+  TEST_CHECK_EQUAL(Gpio_HostData[DioConf_LED1_PORT_NUM] & TEST_LED1_PIN, 0U);
+}
+
+static void Test_ReadBackInTick(void)
+{
+  Test_Tick();
+  LED_setOn();
+  TEST_CHECK_EQUAL(Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX), STD_HIGH);
+  TEST_CHECK_EQUAL(DIO_READ_CHANNEL_STATIC(LED1), STD_HIGH);
+  TEST_CHECK_EQUAL(Dio_ReadPort(DioConf_PORTF_PORT_ID_INDEX) & TEST_LED1_PIN, TEST_LED1_PIN);
+
+  LED_setOff();
+  TEST_CHECK_EQUAL(Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX), STD_LOW);
+  TEST_CHECK_EQUAL(DIO_READ_CHANNEL_STATIC(LED1), STD_LOW);
+  TEST_CHECK_EQUAL(Dio_ReadPort(DioConf_PORTF_PORT_ID_INDEX) & TEST_LED1_PIN, 0U);
+
+  /* The RGB group pins are outputs as well */
+  Dio_WriteChannelGroup(&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX], 0x05U);
+  TEST_CHECK_EQUAL(Dio_ReadChannelGroup(&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX]), 0x05U);
+  Dio_WriteChannelGroup(&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX], 0x02U);
+  TEST_CHECK_EQUAL(Dio_ReadChannelGroup(&Dio_Configuration.Groups[DioConf_RGB_LED_GROUP_ID_INDEX]), 0x02U);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+  Dio_Init(&Dio_Configuration);
+
+  Test_ToggleThenRefresh();
+  Test_ReadBackInTick();
+  return TEST_REPORT("Test_Led");
+}
@@ -0,0 +1,123 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_PortContext.c
+ Author	     : Yasser Waleed
+ Description : Checks Port_SaveContext and Port_RestoreContext around a gated
+               port: the gated port is neither read nor written, the live clock
+               gating is saved and restored as is, and the clocked ports get
+               their registers back after the GPIO state was lost.
+               Port_SwitchConfig goes ahead when the gated port is identical in
+               both sets, and is rejected with no register access when it is not.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include <string.h>
+#include "Test_Host.h"
+#include "Port.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_GATED_PORT                 (2U)            /* PORTC */
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+static uint32 Test_PortAccesses(uint8 Port)
+{
+  uint32 count = 0;
+
+  for (uint16 word = 0; word < GPIO_HW_REGS_WORDS; word++)
+  {
+    count += Gpio_HostReads[Port][word] + Gpio_HostWrites[Port][word];
+  }
+  return count;
+}
+
+static void Test_SaveRestoreGatedPort(void)
+{
+  static Port_ContextType Context;
+  uint32 den[GPIO_HW_NUMBER_OF_PORTS];
+  uint32 clocks;
+
+  Port_Init(&PortConfigrations);
+  Port_GatePortClocks((uint8)(1U << TEST_GATED_PORT));
+  clocks = Gpio_HostRcgcGpio;
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    den[port] = Gpio_HostRegs[port].DEN;
+  }
+
+  Gpio_HostResetCounters();
+  Port_SaveContext(&Context);
+
+  TEST_CHECK_EQUAL(Context.ClockMask, clocks);
+  TEST_CHECK_EQUAL(Context.Ports[TEST_GATED_PORT].PinMask, 0U);
+  TEST_CHECK_EQUAL(Test_PortAccesses(TEST_GATED_PORT), 0U);
+
+  /* Low-power phase: the GPIO registers and the clock gating are lost */
+  memset(Gpio_HostRegs, 0, sizeof(Gpio_HostRegs));
+  Gpio_HostRcgcGpio = 0;
+
+  Gpio_HostResetCounters();
+  Port_RestoreContext(&Context);
+
+  TEST_CHECK_EQUAL(Gpio_HostRcgcGpio, clocks);
+  TEST_CHECK(!BIT_IS_SET(Gpio_HostRcgcGpio, TEST_GATED_PORT));
+  TEST_CHECK_EQUAL(Test_PortAccesses(TEST_GATED_PORT), 0U);
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    if(port != TEST_GATED_PORT)
+    {
+      TEST_CHECK_EQUAL(Gpio_HostRegs[port].DEN, den[port]);
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+}
+
+static void Test_SwitchConfigGatedPort(void)
+{
+  uint32 accesses = 0;
+
+  Port_Init(&PortConfigrations);
+  Port_GatePortClocks((uint8)(1U << TEST_GATED_PORT));
+  Test_ClearDet();
+
+  /* The diagnostic set only differs on PORTA */
+  TEST_CHECK_EQUAL(Port_SwitchConfig(&PortConfigrations, &PortConfigDiagnostic), E_OK);
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+
+  /* The low-power set pulls down the PORTC pins as well */
+  Gpio_HostResetCounters();
+  TEST_CHECK_EQUAL(Port_SwitchConfig(&PortConfigDiagnostic, &PortConfigLowPower), E_NOT_OK);
+  for (uint8 port = 0; port < GPIO_HW_NUMBER_OF_PORTS; port++)
+  {
+    accesses += Test_PortAccesses(port);
+  }
+  TEST_CHECK_EQUAL(accesses, 0U);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  TEST_CHECK_EQUAL(Test_DetCount, 1U);
+  TEST_CHECK_EQUAL(Test_DetError, PORT_E_PORT_NOT_READY);
+#endif
+
+  /* Nothing was applied, the diagnostic set is still the one to switch from */
+  Port_UngatePortClocks((uint8)(1U << TEST_GATED_PORT));
+  Test_ClearDet();
+  TEST_CHECK_EQUAL(Port_SwitchConfig(&PortConfigDiagnostic, &PortConfigLowPower), E_OK);
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_GATED_PORT].PDR & 0xF0U, 0xF0U);
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Test_SaveRestoreGatedPort();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+  Test_SwitchConfigGatedPort();
+
+  return TEST_REPORT("Test_PortContext");
+}
@@ -0,0 +1,115 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_PortPin.c
+ Author	     : Yasser Waleed
+ Description : Runs Port_SetPinDirection and Port_SetPinMode on the host register
+               model and checks that only the bits of the given pin change. In
+               the bitband build (PORT_BIT_BAND_ACCESS) every single-pin update
+               goes through Gpio_HostBitBandStore: one store and no read of the
+               register, the PCTL read-modify-write being the only read left.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Port.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ LOCAL MACROS
+***********************************************************************************/
+#define TEST_PIN_ID                     (11U)           /* PB3, an input with changeable direction and mode */
+#define TEST_PORT_NUM                   (1U)
+#define TEST_PIN                        (0x08U)
+
+/* Word index of a register in Gpio_RegsType */
+#define TEST_WORD(Field)                ((uint16)(offsetof(Gpio_RegsType, Field) / sizeof(uint32)))
+/**********************************************************************************
+ LOCAL FUNCTIONS
+***********************************************************************************/
+static uint32 Test_PortReads(void)
+{
+  uint32 count = 0;
+
+  for (uint16 word = 0; word < GPIO_HW_REGS_WORDS; word++)
+  {
+    count += Gpio_HostReads[TEST_PORT_NUM][word];
+  }
+  return count;
+}
+
+/* Checks that the single-pin update of Field was a store, and a read too without bit-banding */
+static void Test_PinUpdate(uint16 Word)
+{
+  TEST_CHECK_EQUAL(Gpio_HostWrites[TEST_PORT_NUM][Word], 1U);
+#if (PORT_BIT_BAND_ACCESS == STD_ON)
+  TEST_CHECK_EQUAL(Gpio_HostReads[TEST_PORT_NUM][Word], 0U);
+#else
+  TEST_CHECK_EQUAL(Gpio_HostReads[TEST_PORT_NUM][Word], 1U);
+#endif
+}
+
+static void Test_SetPinDirection(void)
+{
+  uint32 dir = Gpio_HostRegs[TEST_PORT_NUM].DIR;
+
+  TEST_CHECK_EQUAL(dir & TEST_PIN, 0U);
+
+  Gpio_HostResetCounters();
+  Port_SetPinDirection(TEST_PIN_ID, PORT_PIN_OUT);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].DIR, dir | TEST_PIN);
+  Test_PinUpdate(TEST_WORD(DIR));
+  TEST_CHECK_EQUAL(Gpio_HostAccessCount(), Gpio_HostWrites[TEST_PORT_NUM][TEST_WORD(DIR)] +
+                                           Gpio_HostReads[TEST_PORT_NUM][TEST_WORD(DIR)]);
+
+  Gpio_HostResetCounters();
+  Port_SetPinDirection(TEST_PIN_ID, PORT_PIN_IN);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].DIR, dir);
+  Test_PinUpdate(TEST_WORD(DIR));
+}
+
+static void Test_SetPinMode(void)
+{
+  uint32 den = Gpio_HostRegs[TEST_PORT_NUM].DEN;
+
+  TEST_CHECK_EQUAL(den & TEST_PIN, TEST_PIN);
+
+  /* Analog: DEN off, AFSEL off, AMSEL on */
+  Gpio_HostResetCounters();
+  Port_SetPinMode(TEST_PIN_ID, PORT_PIN_MODE_ADC);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].DEN, den & ~(uint32)TEST_PIN);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].AMSEL & TEST_PIN, TEST_PIN);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].AFSEL & TEST_PIN, 0U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].PCTL & (0xFUL << 12), 0U);
+  Test_PinUpdate(TEST_WORD(DEN));
+  Test_PinUpdate(TEST_WORD(AFSEL));
+  Test_PinUpdate(TEST_WORD(AMSEL));
+#if (PORT_BIT_BAND_ACCESS == STD_ON)
+  TEST_CHECK_EQUAL(Test_PortReads(), 1U);
+#endif
+
+  /* Back to digital: AMSEL off, DEN on, the drive settings rewritten through the same path */
+  Gpio_HostResetCounters();
+  Port_SetPinMode(TEST_PIN_ID, PORT_PIN_MODE_DIO);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].DEN, den);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].AMSEL & TEST_PIN, 0U);
+  TEST_CHECK_EQUAL(Gpio_HostRegs[TEST_PORT_NUM].AFSEL & TEST_PIN, 0U);
+  Test_PinUpdate(TEST_WORD(DEN));
+  Test_PinUpdate(TEST_WORD(AMSEL));
+#if (PORT_BIT_BAND_ACCESS == STD_ON)
+  TEST_CHECK_EQUAL(Test_PortReads(), 1U);
+#else
+  TEST_CHECK(Test_PortReads() > 1U);
+#endif
+}
+/**********************************************************************************
+ MAIN
+***********************************************************************************/
+int main(void)
+{
+  Port_Init(&PortConfigrations);
+
+  Test_SetPinDirection();
+  Test_SetPinMode();
+  TEST_CHECK_EQUAL(Test_DetCount, 0U);
+  return TEST_REPORT("Test_PortPin");
+}
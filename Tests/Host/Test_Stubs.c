@@ -0,0 +1,50 @@
+/**********************************************************************************
+ Module	     : Tests
+ File Name   : Test_Stubs.c
+ Author	     : Yasser Waleed
+ Description : Host stand-ins for the modules the drivers call: Det records the
+               reported error instead of halting, the button notification only
+               counts its calls.
+***********************************************************************************/
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Test_Host.h"
+#include "Det.h"
+/**********************************************************************************
+ GLOBAL DATA
+***********************************************************************************/
+unsigned long Test_Checks   = 0;
+unsigned long Test_Failures = 0;
+
+uint16 Test_DetModule = 0;
+uint8  Test_DetApi    = 0;
+uint8  Test_DetError  = 0;
+uint32 Test_DetCount  = 0;
+
+uint32 Test_ButtonNotifications = 0;
+/**********************************************************************************
+ FUNCTIONS DEFINITIONS
+***********************************************************************************/
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+  (void)InstanceId;
+  Test_DetModule = ModuleId;
+  Test_DetApi    = ApiId;
+  Test_DetError  = ErrorId;
+  Test_DetCount++;
+  return E_OK;
+}
+
+void Test_ClearDet(void)
+{
+  Test_DetModule = 0;
+  Test_DetApi    = 0;
+  Test_DetError  = 0;
+  Test_DetCount  = 0;
+}
+
+void BUTTON_edgeNotification(void)
+{
+  Test_ButtonNotifications++;
+}
@@ -0,0 +1,57 @@
+#!/bin/sh
+# Module      : Tests
+# File Name   : run_host_tests.sh
+# Author      : Yasser Waleed
+# Description : Builds every Tests/Host/Test_*.c with the host compiler against the
+#               drivers in GPIO_HW_HOST_MODEL mode and runs it, once per build
+#               variant. Exits non-zero when a test fails to build or reports a
+#               failed check.
+#
+#               Usage: sh Tests/Host/run_host_tests.sh [build_dir]
+
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+OUT=${1:-"$ROOT/Tests/Host/build"}
+CC=${CC:-gcc}
+CFLAGS="-std=c99 -Wall -Wno-missing-braces -Wno-unknown-pragmas -DGPIO_HW_HOST_MODEL=STD_ON"
+
+# Drivers linked into every test, the register model stands in for the hardware
+DRIVERS="Port.c Port_PBcfg.c Port_PBimage.c Dio.c Dio_PBcfg.c Gpio_Hw.c Gptm_Hw.c Udma.c Pbus.c Ssi_Hw.c Ws2812.c Bench.c Led.c"
+
+# Build variants: the shipped configuration and the switches it ships OFF
+VARIANTS="default shadow bitband"
+
+variant_flags()
+{
+  case "$1" in
+    shadow)  echo "-DDIO_OUTPUT_SHADOW=STD_ON" ;;
+    bitband) echo "-DPORT_BIT_BAND_ACCESS=STD_ON" ;;
+    *)       echo "" ;;
+  esac
+}
+
+mkdir -p "$OUT" || exit 1
+status=0
+
+for variant in $VARIANTS; do
+  flags=$(variant_flags "$variant")
+  echo "== $variant $flags"
+
+  for test in "$ROOT"/Tests/Host/Test_*.c; do
+    name=$(basename "$test" .c)
+    [ "$name" = "Test_Stubs" ] && continue
+
+    sources="$test $ROOT/Tests/Host/Test_Stubs.c"
+    for driver in $DRIVERS; do
+      sources="$sources $ROOT/$driver"
+    done
+
+    if ! $CC $CFLAGS $flags -I"$ROOT" -I"$ROOT/Tests/Host" $sources -o "$OUT/${name}_$variant"; then
+      echo "$name ($variant): build failed"
+      status=1
+    elif ! "$OUT/${name}_$variant"; then
+      status=1
+    fi
+  done
+done
+
+exit $status
@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+"""
+ Module      : Port
+ File Name   : Port_CfgGen.py
+ Author      : Yasser Waleed
+ Description : Host-side configuration compiler for the Port driver.
+               Reads the pin tables of Port_PBcfg.c and emits Port_PBimage.c,
+               holding for every configuration set the per-port register
+               images and the ordered GPIOLOCK/GPIOCR unlock list that
+               Port_Init copies to the hardware when PORT_PRECOMPILED_IMAGE
+               is STD_ON, and for every pair of sets the register deltas
+               applied by Port_SwitchConfig.
+
+               Usage: python3 Tools/Port_CfgGen.py [--footprint] [project_dir]
+
+               --footprint prints the flash used by the pin table with the
+               former unpacked Port_ConfigPins struct and with the packed one.
+
+               The build is rejected (non-zero exit) when a table configures
+               a JTAG pin (PC0 to PC3), a pin twice, a pin that does not exist,
+               or a pin whose mode conflicts with its direction, resistor or
+               electrical attributes (slew rate control needs 8 mA drive),
+               and when the sets do not list the same pins in the same order.
+"""
+import os
+import re
+import sys
+
+NUMBER_OF_PORTS = 6
+PORT_NAMES = "ABCDEF"
+PINS_PER_PORT = (8, 8, 8, 8, 6, 8)        # PORTE only has PE0 to PE5
+LOCKED_PINS = ((3, 7), (5, 0))            # PD7 and PF0
+JTAG_PINS = ((2, 0), (2, 1), (2, 2), (2, 3))
+
+# Registers of a port image in the order Port_WritePortImage writes them
+IMAGE_REGISTERS = (
+    ("Amsel", "AMSEL", "PORT_ANALOG_MODE_SEL_REG_OFFSET"),
+    ("Afsel", "AFSEL", "PORT_ALT_FUNC_REG_OFFSET"),
+    ("Pctl", "PCTL", "PORT_CTL_REG_OFFSET"),
+    ("Dr2r", "DR2R", "PORT_DRIVE_2MA_REG_OFFSET"),
+    ("Dr4r", "DR4R", "PORT_DRIVE_4MA_REG_OFFSET"),
+    ("Dr8r", "DR8R", "PORT_DRIVE_8MA_REG_OFFSET"),
+    ("Odr", "ODR", "PORT_OPEN_DRAIN_REG_OFFSET"),
+    ("Slr", "SLR", "PORT_SLEW_RATE_REG_OFFSET"),
+    ("Den", "DEN", "PORT_DIGITAL_ENABLE_REG_OFFSET"),
+    ("Pur", "PUR", "PORT_PULL_UP_REG_OFFSET"),
+    ("Pdr", "PDR", "PORT_PULL_DOWN_REG_OFFSET"),
+    ("Data", "DATA", "PORT_DATA_REG_OFFSET"),
+    ("Dir", "DIR", "PORT_DIR_REG_OFFSET"),
+)
+
+
+class ConfigError(Exception):
+    pass
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", text)
+
+
+def parse_enums(header):
+    """Returns {enumerator: value} for every typedef enum of the header."""
+    values = {}
+    for body in re.findall(r"typedef\s+enum\s*\{(.*?)\}", header, flags=re.S):
+        current = -1
+        for item in body.split(","):
+            item = item.strip()
+            if not item:
+                continue
+            if "=" in item:
+                name, value = (part.strip() for part in item.split("="))
+                current = int(value, 0)
+            else:
+                name = item
+                current += 1
+            values[name] = current
+    return values
+
+
+def parse_defines(header):
+    """Returns {macro: value} for every integer object-like macro of the header."""
+    values = {}
+    for name, value in re.findall(r"#define\s+(\w+)\s+\(?\s*(0x[0-9A-Fa-f]+|\d+)U?\s*\)?\s*$", header, flags=re.M):
+        values[name] = int(value, 0)
+    return values
+
+
+# Pin macros of Port.h: number of fields and their expansion to the 11 PORT_CFG_PIN_EX fields
+PIN_MACROS = {
+    "PORT_CFG_PIN_EX": (11, lambda t: t),
+    "PORT_CFG_PIN": (8, lambda t: t + ["PORT_PIN_DRIVE_2MA", "PORT_PIN_SLEW_CONTROL_OFF", "PORT_PIN_PUSH_PULL"]),
+    "PORT_CFG_PIN_HIGH_SPEED": (6, lambda t: t[:2] + ["PORT_PIN_OUT", "OFF"] + t[2:] +
+                                ["PORT_PIN_DRIVE_8MA", "PORT_PIN_SLEW_CONTROL_OFF", "PORT_PIN_PUSH_PULL"]),
+}
+
+
+def parse_pin_tables(source, symbols):
+    """Returns [(set_name, set_id, [pin_rows])] for every Port_ConfigType of the source."""
+    tables = []
+    pattern = r"const\s+Port_ConfigType\s+(\w+)\s*=\s*\{(.*?)\}\s*;"
+    for name, body in re.findall(pattern, strip_comments(source), flags=re.S):
+        set_id = re.match(r"\s*(\w+)\s*,", body)
+        if not set_id or set_id.group(1) not in symbols:
+            raise ConfigError("%s: the table must start with its ConfigSetId" % name)
+        rows = []
+        for index, (macro, fields) in enumerate(re.findall(r"(PORT_CFG_PIN\w*)\s*\((.*?)\)", body, flags=re.S)):
+            tokens = [token.strip() for token in fields.split(",")]
+            if macro not in PIN_MACROS:
+                raise ConfigError("%s: unknown pin macro '%s' in pin %d" % (name, macro, index))
+            if len(tokens) != PIN_MACROS[macro][0]:
+                raise ConfigError("%s: pin %d must hold %d fields" % (name, index, PIN_MACROS[macro][0]))
+            tokens = PIN_MACROS[macro][1](tokens)
+            for token in tokens:
+                if token not in symbols:
+                    raise ConfigError("%s: unknown symbol '%s' in pin %d" % (name, token, index))
+            rows.append(tuple(symbols[token] for token in tokens))
+        tables.append((name, symbols[set_id.group(1)], rows))
+    return tables
+
+
+def check_sets(tables, symbols):
+    """All the sets must exist once and configure the same pins in the same order."""
+    count = symbols["PORT_NUMBER_OF_CONFIG_SETS"]
+    if sorted(set_id for _, set_id, _ in tables) != list(range(count)):
+        raise ConfigError("Port_PBcfg.c: ConfigSetIds must be 0 to %d, each used once" % (count - 1))
+    first_name, _, first_rows = tables[0]
+    for name, _, rows in tables:
+        if len(rows) != symbols["PORT_NUMBER_OF_PORT_PINS"]:
+            raise ConfigError("%s: %d pins configured but PORT_NUMBER_OF_PORT_PINS is %d"
+                              % (name, len(rows), symbols["PORT_NUMBER_OF_PORT_PINS"]))
+        for index, (row, first) in enumerate(zip(rows, first_rows)):
+            if row[:2] != first[:2]:
+                raise ConfigError("%s: pin %d is not the pin of %s at the same index" % (name, index, first_name))
+
+
+def footprint_report(name, rows):
+    """Flash used by the pin table with the unpacked struct and with the packed descriptor."""
+    pins = len(rows)
+    layouts = (
+        ("struct, enums as int (--enum_is_int)", 7 * 4 + 1, 4),
+        ("struct, enums as smallest type", 7 * 1 + 1, 1),
+        ("packed Port_ConfigPins (uint32)", 4, 4),
+    )
+    lines = ["Port_CfgGen: footprint of %s (%d pins)" % (name, pins)]
+    for title, size, align in layouts:
+        size = (size + align - 1) // align * align
+        lines.append("  %-40s %3d B/pin %6d B" % (title, size, size * pins))
+    return "\n".join(lines) + "\n"
+
+
+def check_pins(name, rows, symbols):
+    seen = set()
+    for index, (port, pin, direction, resistor, level, mode, dir_ch, mode_ch, drive, slew, output) in enumerate(rows):
+        where = "%s: pin %d (P%s%d)" % (name, index, PORT_NAMES[port] if port < NUMBER_OF_PORTS else "?", pin)
+        if port >= NUMBER_OF_PORTS or pin >= PINS_PER_PORT[port]:
+            raise ConfigError("%s does not exist on the TM4C123GH6PM" % where)
+        if (port, pin) in JTAG_PINS:
+            raise ConfigError("%s is a JTAG pin and must not be configured" % where)
+        if (port, pin) in seen:
+            raise ConfigError("%s is configured more than once" % where)
+        seen.add((port, pin))
+        if mode > symbols["PORT_PIN_MODE_DIO"]:
+            raise ConfigError("%s has an invalid pin mode %d" % (where, mode))
+        if mode == symbols["PORT_PIN_MODE_ADC"] and direction == symbols["PORT_PIN_OUT"]:
+            raise ConfigError("%s is an analog pin configured as output" % where)
+        if mode == symbols["PORT_PIN_MODE_ADC"] and resistor != symbols["OFF"]:
+            raise ConfigError("%s is an analog pin with an internal resistor" % where)
+        if direction == symbols["PORT_PIN_OUT"] and resistor != symbols["OFF"]:
+            raise ConfigError("%s is an output pin with an internal resistor" % where)
+        if mode == symbols["PORT_PIN_MODE_ADC"] and (drive != symbols["PORT_PIN_DRIVE_2MA"] or
+                                                     slew != symbols["PORT_PIN_SLEW_CONTROL_OFF"] or
+                                                     output != symbols["PORT_PIN_PUSH_PULL"]):
+            raise ConfigError("%s is an analog pin with output electrical attributes" % where)
+        if drive > symbols["PORT_PIN_DRIVE_8MA"]:
+            raise ConfigError("%s has an invalid drive strength %d" % (where, drive))
+        if slew == symbols["PORT_PIN_SLEW_CONTROL_ON"] and drive != symbols["PORT_PIN_DRIVE_8MA"]:
+            raise ConfigError("%s has slew rate control without 8 mA drive" % where)
+
+
+def build_image(rows, symbols):
+    """Folds the pin rows exactly as Port_BuildPortImages does at run time."""
+    ports = [dict(PinMask=0, CommitMask=0, Dir=0, DirFixed=0, Den=0, Amsel=0, Afsel=0, Pur=0, Pdr=0, Data=0,
+                  Dr2r=0, Dr4r=0, Dr8r=0, Odr=0, Slr=0, Pctl=0)
+             for _ in range(NUMBER_OF_PORTS)]
+    for port, pin, direction, resistor, level, mode, dir_ch, mode_ch, drive, slew, output in rows:
+        image = ports[port]
+        bit = 1 << pin
+        image["PinMask"] |= bit
+        if (port, pin) in LOCKED_PINS:
+            image["CommitMask"] |= bit
+        if mode == symbols["PORT_PIN_MODE_DIO"]:
+            image["Den"] |= bit
+        elif mode == symbols["PORT_PIN_MODE_ADC"]:
+            image["Amsel"] |= bit
+        else:
+            image["Afsel"] |= bit
+            image["Pctl"] |= (mode & 0xF) << (pin * 4)
+            image["Den"] |= bit
+        if mode == symbols["PORT_PIN_MODE_ADC"] or drive == symbols["PORT_PIN_DRIVE_2MA"]:
+            image["Dr2r"] |= bit
+        elif drive == symbols["PORT_PIN_DRIVE_4MA"]:
+            image["Dr4r"] |= bit
+        else:
+            image["Dr8r"] |= bit
+        if mode != symbols["PORT_PIN_MODE_ADC"]:
+            if slew == symbols["PORT_PIN_SLEW_CONTROL_ON"]:
+                image["Slr"] |= bit
+            if output == symbols["PORT_PIN_OPEN_DRAIN"]:
+                image["Odr"] |= bit
+        if dir_ch == symbols["DIR_NOT_CHANGEABLE"]:
+            image["DirFixed"] |= bit
+        if direction == symbols["PORT_PIN_OUT"]:
+            image["Dir"] |= bit
+            if level == symbols["HIGH"]:
+                image["Data"] |= bit
+        elif resistor == symbols["PULL_UP"]:
+            image["Pur"] |= bit
+        elif resistor == symbols["PULL_DOWN"]:
+            image["Pdr"] |= bit
+    clock_mask = 0
+    unlock = []
+    for port, image in enumerate(ports):
+        if image["PinMask"]:
+            clock_mask |= 1 << port
+        if image["CommitMask"]:
+            unlock.append((port, image["CommitMask"]))
+    return clock_mask, unlock, ports
+
+
+def emit_image(name, rows, clock_mask, unlock, ports, max_unlock):
+    out = []
+    out.append("\t/* Register images compiled from %s (%d pins) */" % (name, len(rows)))
+    out.append("\t{")
+    out.append("\t  0x%02X,\t/* ClockMask */" % clock_mask)
+    out.append("\t  %d,\t/* UnlockCount */" % len(unlock))
+    entries = ["{ %d, 0x%02X }" % entry for entry in unlock]
+    entries += ["{ 0, 0x00 }"] * (max_unlock - len(unlock))
+    out.append("\t  { %s },\t/* Unlock (PORT NUM, COMMIT MASK) */" % ", ".join(entries))
+    out.append("\t  {")
+    out.append("\t    /*PIN MASK, COMMIT, DIR , FIXED, DEN , AMSEL, AFSEL, PUR , PDR , DATA, DR2R, DR4R, DR8R, ODR , SLR , PCTL*/")
+    for port, image in enumerate(ports):
+        out.append("\t    { 0x%02X    , 0x%02X  , 0x%02X, 0x%02X , 0x%02X, 0x%02X , 0x%02X , 0x%02X, 0x%02X, 0x%02X, "
+                   "0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%08XU }%s /* PORT%s */"
+                   % (image["PinMask"], image["CommitMask"], image["Dir"], image["DirFixed"], image["Den"], image["Amsel"],
+                      image["Afsel"], image["Pur"], image["Pdr"], image["Data"], image["Dr2r"], image["Dr4r"],
+                      image["Dr8r"], image["Odr"], image["Slr"], image["Pctl"],
+                      "," if port < NUMBER_OF_PORTS - 1 else " ", PORT_NAMES[port]))
+    out.append("\t  }")
+    out.append("\t}")
+    return "\n".join(out)
+
+
+def build_delta(from_ports, to_ports):
+    """Register updates turning the images of one set into the images of another."""
+    delta = []
+    for port in range(NUMBER_OF_PORTS):
+        for field, register, offset in IMAGE_REGISTERS:
+            mask = from_ports[port][field] ^ to_ports[port][field]
+            if mask:
+                delta.append((port, register, offset, mask, to_ports[port][field] & mask))
+    return delta
+
+
+def emit_deltas(sets):
+    out = []
+    count = len(sets)
+    for source in range(count):
+        for target in range(count):
+            delta = build_delta(sets[source][1], sets[target][1])
+            if source == target or not delta:
+                continue
+            out.append("/* %s -> %s */" % (sets[source][0], sets[target][0]))
+            out.append("static const Port_RegDeltaType Port_Delta_%d_%d[%d] = {" % (source, target, len(delta)))
+            out.append("\t/*PORT, REGISTER INDEX                        , MASK       , VALUE*/")
+            for index, (port, register, offset, mask, value) in enumerate(delta):
+                out.append("\t{ %d   , %-39s, 0x%08XU, 0x%08XU }%s /* PORT%s %s */"
+                           % (port, "(%s >> 2)" % offset, mask, value, "," if index < len(delta) - 1 else " ",
+                              PORT_NAMES[port], register))
+            out.append("};")
+            out.append("")
+    out.append("const Port_ConfigDeltaType Port_ConfigDeltas[PORT_NUMBER_OF_CONFIG_SETS][PORT_NUMBER_OF_CONFIG_SETS] = {")
+    for source in range(count):
+        entries = []
+        for target in range(count):
+            delta = build_delta(sets[source][1], sets[target][1])
+            if source == target or not delta:
+                entries.append("{ 0, NULL_PTR }")
+            else:
+                entries.append("{ %d, Port_Delta_%d_%d }" % (len(delta), source, target))
+        out.append("\t{ %s }%s" % (", ".join(entries), "," if source < count - 1 else ""))
+    out.append("};")
+    return "\n".join(out)
+
+
+HEADER = """/********************************************************************************
+ Module	        : Port
+ File Name	: Port_PBimage.c
+ Author		: Yasser Waleed
+ Description    : Precompiled register images of the post-build configuration sets
+                  and the register deltas between every pair of sets.
+                  GENERATED by Tools/Port_CfgGen.py from Port_PBcfg.c, do not edit.
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Port.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Catch images generated from pin tables of a different size */
+#if ((PORT_NUMBER_OF_PORT_PINS != %dU) || (PORT_NUMBER_OF_CONFIG_SETS != %dU))
+  #error "Port_PBimage.c is out of date, rerun Tools/Port_CfgGen.py"
+#endif
+/********************************************************************************
+ REGISTER IMAGES
+*********************************************************************************/
+#if (PORT_PRECOMPILED_IMAGE == STD_ON)
+
+const Port_ImageSetType Port_PrecompiledImages[PORT_NUMBER_OF_CONFIG_SETS] = {
+"""
+
+DELTAS = """
+};
+/********************************************************************************
+ CONFIGURATION SET DELTAS
+*********************************************************************************/
+"""
+
+FOOTER = """
+
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+"""
+
+
+def main(argv):
+    footprint = "--footprint" in argv[1:]
+    args = [arg for arg in argv[1:] if arg != "--footprint"]
+    project = args[0] if args else os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    read = lambda name: open(os.path.join(project, name)).read()
+
+    header = strip_comments(read("Port.h"))
+    cfg = strip_comments(read("Port_Cfg.h"))
+    symbols = parse_enums(header)
+    symbols.update(parse_defines(cfg))
+
+    try:
+        tables = parse_pin_tables(read("Port_PBcfg.c"), symbols)
+        if not tables:
+            raise ConfigError("Port_PBcfg.c: no Port_ConfigType table found")
+        check_sets(tables, symbols)
+        tables.sort(key=lambda table: table[1])
+        images = []
+        for name, set_id, rows in tables:
+            check_pins(name, rows, symbols)
+            clock_mask, unlock, ports = build_image(rows, symbols)
+            if len(unlock) > symbols["PORT_MAX_UNLOCK_ENTRIES"]:
+                raise ConfigError("%s: more locked ports than PORT_MAX_UNLOCK_ENTRIES" % name)
+            images.append((name, rows, clock_mask, unlock, ports))
+    except ConfigError as error:
+        sys.stderr.write("Port_CfgGen: error: %s\n" % error)
+        return 1
+
+    if footprint:
+        sys.stdout.write(footprint_report(images[0][0], images[0][1]))
+
+    body = ",\n\n".join(emit_image(name, rows, clock_mask, unlock, ports, symbols["PORT_MAX_UNLOCK_ENTRIES"])
+                         for name, rows, clock_mask, unlock, ports in images)
+    deltas = emit_deltas([(name, ports) for name, rows, clock_mask, unlock, ports in images])
+    with open(os.path.join(project, "Port_PBimage.c"), "w") as output:
+        output.write(HEADER % (len(images[0][1]), len(images)) + body + DELTAS + deltas + FOOTER)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
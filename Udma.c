@@ -0,0 +1,291 @@
+/********************************************************************************
+ Module	        : Udma
+ File Name	: Udma.c
+ Author		: Yasser Waleed
+ Description    : Source file for the TM4C123GH6PM uDMA controller driver
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Udma.h"
+#include "Common_Macros.h"
+/********************************************************************************
+ LOCAL MACROS
+*********************************************************************************/
+/*
+ * The controller attribute registers come in SET/CLR pairs and DMACHIS is
+ * write-1-to-clear. The host model keeps the state in the SET register itself.
+ */
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define UDMA_ATTR_SET(SetReg, ClrReg, Mask)   ((SetReg) |= (Mask))
+#define UDMA_ATTR_CLR(SetReg, ClrReg, Mask)   ((SetReg) &= ~(Mask))
+#define UDMA_W1C(Reg, Mask)                   ((Reg) &= ~(Mask))
+#else
+#define UDMA_ATTR_SET(SetReg, ClrReg, Mask)   ((SetReg) = (Mask))
+#define UDMA_ATTR_CLR(SetReg, ClrReg, Mask)   ((ClrReg) = (Mask))
+#define UDMA_W1C(Reg, Mask)                   ((Reg) = (Mask))
+#endif
+
+/* Control structure of the channel, the alternate structures follow the 32 primary ones */
+#define UDMA_CONTROL(Channel, Alternate) \
+  (&Udma_ControlTable[(Channel) + (((Alternate) == TRUE) ? UDMA_NUMBER_OF_CHANNELS : 0U)])
+/********************************************************************************
+ LOCAL VARIABLES
+*********************************************************************************/
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+Udma_RegsType Udma_HostRegs;
+volatile uint32 Udma_HostRcgcDma = 0;
+#else
+/* DMACTLBASE requires the control table on a 1024-byte boundary */
+#pragma data_alignment = 1024
+#endif
+static Udma_ControlType Udma_ControlTable[2U * UDMA_NUMBER_OF_CHANNELS];
+
+static boolean Udma_Initialized = FALSE;
+/********************************************************************************
+ FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Function Name: Udma_Init
+* Parameters (in): None
+* Return value: None
+* Description: Clocks the controller, waits for it to be ready, enables it and
+*              sets the control table base. Later calls return at once so every
+*              driver using a channel may call it.
+************************************************************************************/
+void Udma_Init(void)
+{
+  if(FALSE == Udma_Initialized)
+  {
+    UDMA_HW_RCGCDMA_REG |= 0x1UL;
+    while(BIT_IS_CLEAR(UDMA_HW_PRDMA_REG, 0))
+    {
+      /* Wait for the controller to be ready */
+    }
+
+    UDMA_HW_REGS->CFG = 0x1UL;        /* MASTEN */
+#if (GPIO_HW_HOST_MODEL == STD_OFF)
+    UDMA_HW_REGS->CTLBASE = (uint32)&Udma_ControlTable[0];
+#endif
+    Udma_Initialized = TRUE;
+  }
+  else
+  {
+    /* Do Nothing ... already initialized */
+  }
+}
+
+/************************************************************************************
+* Function Name: Udma_ConfigureChannel
+* Parameters (in): Channel - uDMA channel number
+*                  Encoding - DMACHMAPn peripheral encoding of the channel
+* Return value: None
+* Description: Assigns the channel to its peripheral and resets the channel
+*              attributes: primary structure, single and burst requests, default
+*              priority, requests not masked.
+************************************************************************************/
+void Udma_ConfigureChannel(uint8 Channel, uint8 Encoding)
+{
+  Udma_RegsType * Regs = UDMA_HW_REGS;
+  uint32 mask = (1UL << Channel);
+  uint8 shift = (uint8)((Channel % 8U) * 4U);
+
+  UDMA_ATTR_CLR(Regs->ENASET, Regs->ENACLR, mask);
+  Regs->CHMAP[Channel / 8U] = (Regs->CHMAP[Channel / 8U] & ~(0xFUL << shift)) | ((uint32)Encoding << shift);
+  UDMA_ATTR_CLR(Regs->ALTSET, Regs->ALTCLR, mask);
+  UDMA_ATTR_CLR(Regs->USEBURSTSET, Regs->USEBURSTCLR, mask);
+  UDMA_ATTR_CLR(Regs->REQMASKSET, Regs->REQMASKCLR, mask);
+  UDMA_ATTR_CLR(Regs->PRIOSET, Regs->PRIOCLR, mask);
+  UDMA_W1C(Regs->CHIS, mask);
+}
+
+/************************************************************************************
+* Function Name: Udma_SetTransfer
+* Parameters (in): Channel - uDMA channel number
+*                  Alternate - TRUE for the alternate control structure
+*                  SrcEnd - Address of the last source item
+*                  DstEnd - Address of the last destination item
+*                  Control - DMACHCTL control word
+* Return value: None
+* Description: Programs one control structure of the channel.
+************************************************************************************/
+void Udma_SetTransfer(uint8 Channel, boolean Alternate, volatile void * SrcEnd, volatile void * DstEnd, uint32 Control)
+{
+  Udma_ControlType * Ctl = UDMA_CONTROL(Channel, Alternate);
+
+  Ctl->SrcEnd  = SrcEnd;
+  Ctl->DstEnd  = DstEnd;
+  Ctl->Control = Control;
+}
+
+/************************************************************************************
+* Function Name: Udma_SetControl
+* Parameters (in): Channel - uDMA channel number
+*                  Alternate - TRUE for the alternate control structure
+*                  Control - DMACHCTL control word
+* Return value: None
+* Description: Re-arms a control structure whose end pointers are unchanged.
+************************************************************************************/
+void Udma_SetControl(uint8 Channel, boolean Alternate, uint32 Control)
+{
+  UDMA_CONTROL(Channel, Alternate)->Control = Control;
+}
+
+/************************************************************************************
+* Function Name: Udma_GetRemaining
+* Parameters (in): Channel - uDMA channel number
+*                  Alternate - TRUE for the alternate control structure
+* Return value: uint16 - Items still to be moved by the structure
+* Description: The controller writes the control word back after every
+*              arbitration, so the XFERSIZE field tracks the progress.
+************************************************************************************/
+uint16 Udma_GetRemaining(uint8 Channel, boolean Alternate)
+{
+  uint32 control = UDMA_CONTROL(Channel, Alternate)->Control;
+  uint16 remaining = 0;
+
+  if((control & UDMA_CTL_MODE_MASK) != UDMA_CTL_MODE_STOP)
+  {
+    remaining = UDMA_CTL_XFER_SIZE_GET(control);
+  }
+  else
+  {
+    /* Do Nothing ... the structure has completed */
+  }
+  return remaining;
+}
+
+/************************************************************************************
+* Function Name: Udma_EnableChannel / Udma_DisableChannel
+* Parameters (in): Channel - uDMA channel number
+* Return value: None
+* Description: Starts or stops serving the peripheral requests of the channel.
+************************************************************************************/
+void Udma_EnableChannel(uint8 Channel)
+{
+  UDMA_ATTR_SET(UDMA_HW_REGS->ENASET, UDMA_HW_REGS->ENACLR, (1UL << Channel));
+}
+
+void Udma_DisableChannel(uint8 Channel)
+{
+  UDMA_ATTR_CLR(UDMA_HW_REGS->ENASET, UDMA_HW_REGS->ENACLR, (1UL << Channel));
+}
+
+/************************************************************************************
+* Function Name: Udma_IsChannelDone / Udma_ClearChannelDone
+* Parameters (in): Channel - uDMA channel number
+* Return value: boolean - TRUE if the channel completed a control structure
+* Description: The completion raises the interrupt of the channel peripheral,
+*              whose handler checks and acknowledges it in DMACHIS.
+************************************************************************************/
+boolean Udma_IsChannelDone(uint8 Channel)
+{
+  return (BIT_IS_SET(UDMA_HW_REGS->CHIS, Channel) != 0) ? TRUE : FALSE;
+}
+
+void Udma_ClearChannelDone(uint8 Channel)
+{
+  UDMA_W1C(UDMA_HW_REGS->CHIS, (1UL << Channel));
+}
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/************************************************************************************
+* Function Name: Udma_HostRequest
+* Parameters (in): Channel - uDMA channel number
+* Return value: boolean - TRUE if the request completed the active structure
+* Description: Host model of one peripheral request: moves one arbitration of
+*              items of the active control structure, writes the control word
+*              back, and on completion flags DMACHIS and switches to the other
+*              structure (ping-pong) or disables the channel (basic).
+************************************************************************************/
+boolean Udma_HostRequest(uint8 Channel)
+{
+  Udma_RegsType * Regs = &Udma_HostRegs;
+  uint32 mask = (1UL << Channel);
+  boolean alternate = (Regs->ALTSET & mask) ? TRUE : FALSE;
+  Udma_ControlType * Ctl = UDMA_CONTROL(Channel, alternate);
+  uint32 control = Ctl->Control;
+  uint32 mode = control & UDMA_CTL_MODE_MASK;
+  boolean done = FALSE;
+
+  if(((Regs->ENASET & mask) != 0) && (mode != UDMA_CTL_MODE_STOP))
+  {
+    uint8  srcSize = (uint8)(1U << ((control >> 24) & 0x3U));
+    uint8  srcInc  = (uint8)((((control >> 26) & 0x3U) == 0x3U) ? 0U : (1U << ((control >> 26) & 0x3U)));
+    uint8  dstInc  = (uint8)((((control >> 30) & 0x3U) == 0x3U) ? 0U : (1U << ((control >> 30) & 0x3U)));
+    uint16 items   = (uint16)(1U << ((control >> 14) & 0xFU));
+    uint16 remaining = UDMA_CTL_XFER_SIZE_GET(control);
+
+    if(items > remaining)
+    {
+      items = remaining;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+
+    for (uint16 item = 0; item < items; item++)
+    {
+      volatile uint8 * src = (volatile uint8 *)Ctl->SrcEnd - ((uint32)(remaining - 1U) * srcInc);
+      volatile uint8 * dst = (volatile uint8 *)Ctl->DstEnd - ((uint32)(remaining - 1U) * dstInc);
+      uint32 value = 0;
+      uint8 port;
+      uint16 word;
+
+      /* GPIO registers go through the register model, GPIODATA applies its address mask */
+      if(Gpio_HostLocate(src, &port, &word))
+      {
+        value = Gpio_HostRead((const volatile uint32 *)src);
+      }
+      else
+      {
+        for (uint8 byte = 0; byte < srcSize; byte++)
+        {
+          value |= (uint32)src[byte] << (byte * 8U);
+        }
+      }
+
+      if(Gpio_HostLocate(dst, &port, &word))
+      {
+        Gpio_HostWrite((volatile uint32 *)dst, value);
+      }
+      else
+      {
+        for (uint8 byte = 0; byte < srcSize; byte++)
+        {
+          dst[byte] = (uint8)(value >> (byte * 8U));
+        }
+      }
+      remaining--;
+    }
+
+    if(remaining == 0)
+    {
+      Ctl->Control = (control & ~(UDMA_CTL_XFER_SIZE(UDMA_MAX_TRANSFER_SIZE) | UDMA_CTL_MODE_MASK)) | UDMA_CTL_MODE_STOP;
+      Regs->CHIS |= mask;
+      if(mode == UDMA_CTL_MODE_PINGPONG)
+      {
+        Regs->ALTSET ^= mask;
+      }
+      else
+      {
+        Regs->ENASET &= ~mask;
+      }
+      done = TRUE;
+    }
+    else
+    {
+      Ctl->Control = (control & ~UDMA_CTL_XFER_SIZE(UDMA_MAX_TRANSFER_SIZE)) | UDMA_CTL_XFER_SIZE(remaining);
+    }
+  }
+  else
+  {
+    /* Do Nothing ... no transfer pending on the channel */
+  }
+  return done;
+}
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
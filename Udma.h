@@ -0,0 +1,146 @@
+/**********************************************************************************
+ Module	     : Udma
+ File Name   : Udma.h
+ Author	     : Yasser Waleed
+ Description : Micro Direct Memory Access (uDMA) controller driver for the
+               TM4C123GH6PM. Owns the channel control table and offers the
+               channel services used by the peripheral drivers.
+***********************************************************************************/
+#ifndef UDMA_H
+#define UDMA_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "tm4c123gh6pm_registers.h"
+#include "Gpio_Hw.h"
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+#define UDMA_NUMBER_OF_CHANNELS         (32U)
+
+#define UDMA_MAX_TRANSFER_SIZE          (1024U)         /* Items moved by one control structure */
+
+/* Channel control word fields (DMACHCTL) */
+#define UDMA_CTL_DST_INC_8              (0x0UL << 30)
+#define UDMA_CTL_DST_INC_16             (0x1UL << 30)
+#define UDMA_CTL_DST_INC_32             (0x2UL << 30)
+#define UDMA_CTL_DST_INC_NONE           (0x3UL << 30)
+#define UDMA_CTL_DST_SIZE_8             (0x0UL << 28)
+#define UDMA_CTL_DST_SIZE_16            (0x1UL << 28)
+#define UDMA_CTL_DST_SIZE_32            (0x2UL << 28)
+#define UDMA_CTL_SRC_INC_8              (0x0UL << 26)
+#define UDMA_CTL_SRC_INC_16             (0x1UL << 26)
+#define UDMA_CTL_SRC_INC_32             (0x2UL << 26)
+#define UDMA_CTL_SRC_INC_NONE           (0x3UL << 26)
+#define UDMA_CTL_SRC_SIZE_8             (0x0UL << 24)
+#define UDMA_CTL_SRC_SIZE_16            (0x1UL << 24)
+#define UDMA_CTL_SRC_SIZE_32            (0x2UL << 24)
+#define UDMA_CTL_ARB_1                  (0x0UL << 14)
+#define UDMA_CTL_ARB_4                  (0x2UL << 14)
+#define UDMA_CTL_MODE_STOP              (0x0UL)
+#define UDMA_CTL_MODE_BASIC             (0x1UL)
+#define UDMA_CTL_MODE_PINGPONG          (0x3UL)
+#define UDMA_CTL_MODE_MASK              (0x7UL)
+
+/* Transfer size field, Items is 1..UDMA_MAX_TRANSFER_SIZE */
+#define UDMA_CTL_XFER_SIZE(Items)       ((((uint32)(Items) - 1UL) & 0x3FFUL) << 4)
+#define UDMA_CTL_XFER_SIZE_GET(Ctl)     ((uint16)((((Ctl) >> 4) & 0x3FFUL) + 1UL))
+
+/* Channel assignments used by the drivers (channel number, DMACHMAPn encoding) */
+#define UDMA_CH11_SSI0_TX               (11U)
+#define UDMA_CH18_TIMER0A               (18U)
+#define UDMA_CH20_TIMER1A               (20U)
+#define UDMA_ENC_0                      (0U)
+
+#define UDMA_NVIC_IRQ_ERROR             (47U)           /* uDMA error interrupt */
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+#define UDMA_HW_RCGCDMA_REG             (Udma_HostRcgcDma)
+#define UDMA_HW_PRDMA_REG               (Udma_HostRcgcDma)
+#define UDMA_HW_REGS                    (&Udma_HostRegs)
+#else
+#define UDMA_HW_RCGCDMA_REG             SYSCTL_RCGCDMA_REG
+#define UDMA_HW_PRDMA_REG               SYSCTL_PRDMA_REG
+#define UDMA_HW_REGS                    ((Udma_RegsType *)UDMA_BASE_ADDRESS)
+#endif
+/**********************************************************************************
+ DATA TYPES
+***********************************************************************************/
+/* Overlay of the uDMA register block */
+typedef struct
+{
+  volatile uint32 STAT;                 /* 0x000 DMASTAT         */
+  volatile uint32 CFG;                  /* 0x004 DMACFG          */
+  volatile uint32 CTLBASE;              /* 0x008 DMACTLBASE      */
+  volatile uint32 ALTBASE;              /* 0x00C DMAALTBASE      */
+  volatile uint32 WAITSTAT;             /* 0x010 DMAWAITSTAT     */
+  volatile uint32 SWREQ;                /* 0x014 DMASWREQ        */
+  volatile uint32 USEBURSTSET;          /* 0x018 DMAUSEBURSTSET  */
+  volatile uint32 USEBURSTCLR;          /* 0x01C DMAUSEBURSTCLR  */
+  volatile uint32 REQMASKSET;           /* 0x020 DMAREQMASKSET   */
+  volatile uint32 REQMASKCLR;           /* 0x024 DMAREQMASKCLR   */
+  volatile uint32 ENASET;               /* 0x028 DMAENASET       */
+  volatile uint32 ENACLR;               /* 0x02C DMAENACLR       */
+  volatile uint32 ALTSET;               /* 0x030 DMAALTSET       */
+  volatile uint32 ALTCLR;               /* 0x034 DMAALTCLR       */
+  volatile uint32 PRIOSET;              /* 0x038 DMAPRIOSET      */
+  volatile uint32 PRIOCLR;              /* 0x03C DMAPRIOCLR      */
+  volatile uint32 RESERVED0[3];         /* 0x040-0x048           */
+  volatile uint32 ERRCLR;               /* 0x04C DMAERRCLR       */
+  volatile uint32 RESERVED1[300];       /* 0x050-0x4FC           */
+  volatile uint32 CHASGN;               /* 0x500 DMACHASGN       */
+  volatile uint32 CHIS;                 /* 0x504 DMACHIS         */
+  volatile uint32 RESERVED2[2];         /* 0x508-0x50C           */
+  volatile uint32 CHMAP[4];             /* 0x510-0x51C DMACHMAP0..3 */
+} Udma_RegsType;
+
+/* One channel control structure of the control table */
+typedef struct
+{
+  volatile void * volatile SrcEnd;      /* Address of the last source item      */
+  volatile void * volatile DstEnd;      /* Address of the last destination item */
+  volatile uint32 Control;              /* DMACHCTL control word                */
+  volatile uint32 Unused;
+} Udma_ControlType;
+/**********************************************************************************
+ EXTERNAL VARIABLES
+***********************************************************************************/
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/* RAM-backed controller registers used by host builds */
+extern Udma_RegsType Udma_HostRegs;
+extern volatile uint32 Udma_HostRcgcDma;
+#endif
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+/* Clocks and enables the controller and points it to the control table, done once */
+void Udma_Init(void);
+
+/* Maps the channel to the peripheral selected by Encoding and resets its attributes */
+void Udma_ConfigureChannel(uint8 Channel, uint8 Encoding);
+
+/* Programs the primary (Alternate = FALSE) or alternate control structure of the channel */
+void Udma_SetTransfer(uint8 Channel, boolean Alternate, volatile void * SrcEnd, volatile void * DstEnd, uint32 Control);
+
+/* Rewrites only the control word, to re-arm a structure whose end pointers are unchanged */
+void Udma_SetControl(uint8 Channel, boolean Alternate, uint32 Control);
+
+/* Items still to be moved by the given control structure, 0 once it has completed */
+uint16 Udma_GetRemaining(uint8 Channel, boolean Alternate);
+
+void Udma_EnableChannel(uint8 Channel);
+void Udma_DisableChannel(uint8 Channel);
+
+/* Reports and acknowledges the completion of the channel (DMACHIS) */
+boolean Udma_IsChannelDone(uint8 Channel);
+void Udma_ClearChannelDone(uint8 Channel);
+
+#if (GPIO_HW_HOST_MODEL == STD_ON)
+/* Serves one peripheral request of the channel like the controller does, returns TRUE on completion */
+boolean Udma_HostRequest(uint8 Channel);
+#endif
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
@@ -0,0 +1,327 @@
+/********************************************************************************
+ Module	        : Ws2812
+ File Name	: Ws2812.c
+ Author		: Yasser Waleed
+ Description    : Source file of the WS2812 addressable LED strip driver
+*********************************************************************************/
+/********************************************************************************
+ INCLUDES
+*********************************************************************************/
+#include "Ws2812.h"
+#include "Port.h"
+#include "Gpio_Hw.h"
+#include "Ssi_Hw.h"
+#include "Udma.h"
+/********************************************************************************
+ DEVELOPMENT ERRORS DETECTION
+*********************************************************************************/
+#if (WS2812_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Ws2812 Modules */
+#if ((DET_AR_MAJOR_VERSION != WS2812_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != WS2812_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != WS2812_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* The data pin is muxed to SSI0Tx through the Port pin mode service */
+#if (PORT_SET_PIN_MODE_API == STD_OFF)
+  #error "Ws2812 needs PORT_SET_PIN_MODE_API"
+#endif
+/********************************************************************************
+ LOCAL MACROS
+*********************************************************************************/
+#define WS2812_SSI                      (0U)
+#define WS2812_CHANNEL                  UDMA_CH11_SSI0_TX
+
+/* A frame is moved in chunks of one uDMA control structure each */
+#define WS2812_CHUNKS                   ((WS2812_FRAME_BYTES + UDMA_MAX_TRANSFER_SIZE - 1U) / UDMA_MAX_TRANSFER_SIZE)
+
+/* Bytes into SSIDR, four per arbitration as the TX FIFO requests at half empty */
+#define WS2812_CONTROL(Length, Mode)    (UDMA_CTL_DST_INC_NONE | UDMA_CTL_DST_SIZE_8 | UDMA_CTL_SRC_INC_8 | \
+                                         UDMA_CTL_SRC_SIZE_8 | UDMA_CTL_ARB_4 | UDMA_CTL_XFER_SIZE(Length) | (Mode))
+/********************************************************************************
+ LOCAL VARIABLES
+*********************************************************************************/
+static uint8 Ws2812_Status = WS2812_NOT_INITIALIZED;
+
+/* 12 code bits of every LED nibble, MSB first: 0 is 100 and 1 is 110 */
+static const uint16 Ws2812_NibbleCode[16] = {
+	0x924, 0x926, 0x934, 0x936, 0x9A4, 0x9A6, 0x9B4, 0x9B6,
+	0xD24, 0xD26, 0xD34, 0xD36, 0xDA4, 0xDA6, 0xDB4, 0xDB6
+};
+
+/* Encoded frames, each closed by the low reset bytes */
+static uint8 Ws2812_Frame[2][WS2812_FRAME_BYTES];
+
+/* Frame prepared by Ws2812_SetPixel, the other one is the transmitted frame */
+static uint8 Ws2812_Back = 0;
+
+/* Chunks of the transmitted frame armed and completed */
+static uint8 Ws2812_Armed = 0;
+static uint8 Ws2812_Completed = 0;
+static volatile boolean Ws2812_Busy = FALSE;
+/********************************************************************************
+ LOCAL FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Function Name: Ws2812_EncodePixel
+* Parameters (in): Code - First code byte of the pixel, Red, Green, Blue - Color
+* Return value: None
+* Description: Writes the 72 code bits of a pixel in the G, R, B order of the LED.
+************************************************************************************/
+static void Ws2812_EncodePixel(uint8 * Code, uint8 Red, uint8 Green, uint8 Blue)
+{
+  const uint8 Colors[3] = { Green, Red, Blue };
+
+  for (uint8 color = 0; color < 3U; color++)
+  {
+    uint32 bits = ((uint32)Ws2812_NibbleCode[Colors[color] >> 4] << 12) | Ws2812_NibbleCode[Colors[color] & 0x0FU];
+
+    Code[0] = (uint8)(bits >> 16);
+    Code[1] = (uint8)(bits >> 8);
+    Code[2] = (uint8)bits;
+    Code += WS2812_BITS_PER_CODE;
+  }
+}
+
+/************************************************************************************
+* Function Name: Ws2812_ArmChunk
+* Parameters (in): Alternate - Control structure to program, Chunk - Chunk index
+* Return value: None
+* Description: Programs a chunk of the transmitted frame. The last chunk is a
+*              basic transfer, so the channel stops after it.
+************************************************************************************/
+static void Ws2812_ArmChunk(boolean Alternate, uint8 Chunk)
+{
+  uint8 * Frame = Ws2812_Frame[Ws2812_Back ^ 1U];
+  uint32 Offset = (uint32)Chunk * UDMA_MAX_TRANSFER_SIZE;
+  uint32 Length = WS2812_FRAME_BYTES - Offset;
+  uint32 Mode = UDMA_CTL_MODE_BASIC;
+
+  if(Length > UDMA_MAX_TRANSFER_SIZE)
+  {
+    Length = UDMA_MAX_TRANSFER_SIZE;
+    Mode = UDMA_CTL_MODE_PINGPONG;
+  }
+  else
+  {
+    /* Do Nothing ... last chunk */
+  }
+
+  Udma_SetTransfer(WS2812_CHANNEL, Alternate, &Frame[Offset + Length - 1U], &SSI_HW_MODULE(WS2812_SSI)->DR,
+                   WS2812_CONTROL(Length, Mode));
+}
+/********************************************************************************
+ FUNCTIONS
+*********************************************************************************/
+/************************************************************************************
+* Service Name: Ws2812_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Encodes a black frame in both buffers, muxes the data pin to
+*              SSI0Tx and sets SSI0 up as the uDMA driven bit stream master.
+************************************************************************************/
+void Ws2812_Init(void)
+{
+  Ssi_RegsType * Ssi = SSI_HW_MODULE(WS2812_SSI);
+  uint8 irq = SSI_HW_IRQ(WS2812_SSI);
+
+  for (uint8 frame = 0; frame < 2U; frame++)
+  {
+    for (uint16 pixel = 0; pixel < WS2812_NUMBER_OF_PIXELS; pixel++)
+    {
+      Ws2812_EncodePixel(&Ws2812_Frame[frame][pixel * WS2812_BYTES_PER_PIXEL], 0, 0, 0);
+    }
+    for (uint16 index = WS2812_NUMBER_OF_PIXELS * WS2812_BYTES_PER_PIXEL; index < WS2812_FRAME_BYTES; index++)
+    {
+      Ws2812_Frame[frame][index] = 0;
+    }
+  }
+
+  Port_SetPinMode(WS2812_TX_PIN, WS2812_TX_PIN_MODE);
+
+  /* Master, Freescale SPI, 8-bit frames, only the TX FIFO requests the uDMA. With SPH = 0
+     SSInFss is pulsed between frames, which puts an idle bit clock after every byte; with
+     SPH = 1 back-to-back frames leave no gap and the code bits stream evenly */
+  Ssi_Hw_EnableSsi(WS2812_SSI);
+  Ssi->CC     = 0;
+  Ssi->CPSR   = WS2812_SSI_CPSDVSR;
+  Ssi->CR0    = SSI_HW_CR0_SCR(WS2812_SSI_SCR) | SSI_HW_CR0_SPH | SSI_HW_CR0_DSS_8;
+  Ssi->IM     = 0;
+  Ssi->DMACTL = SSI_HW_DMACTL_TXDMAE;
+  Ssi->CR1   |= SSI_HW_CR1_SSE;
+
+  Udma_Init();
+  Udma_ConfigureChannel(WS2812_CHANNEL, UDMA_ENC_0);
+
+  GPIO_HW_NVIC_SET_PRIORITY(irq, WS2812_INTERRUPT_PRIORITY);
+  GPIO_HW_NVIC_EN_REG(irq) = (1UL << (irq & 0x1FU));
+
+  Ws2812_Back   = 0;
+  Ws2812_Busy   = FALSE;
+  Ws2812_Status = WS2812_INITIALIZED;
+}
+
+/************************************************************************************
+* Service Name: Ws2812_SetPixel
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Pixel - Index of the pixel on the strip
+*                  Red, Green, Blue - Color of the pixel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Encodes the pixel into the frame being prepared.
+************************************************************************************/
+void Ws2812_SetPixel(uint16 Pixel, uint8 Red, uint8 Green, uint8 Blue)
+{
+  #if (WS2812_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Ws2812_Status == WS2812_NOT_INITIALIZED)
+  {
+    Det_ReportError(WS2812_MODULE_ID, WS2812_INSTANCE_ID, WS2812_SET_PIXEL, WS2812_E_UNINIT);
+    return;
+  }
+  /* check if the pixel is on the strip */
+  else if(Pixel >= WS2812_NUMBER_OF_PIXELS)
+  {
+    Det_ReportError(WS2812_MODULE_ID, WS2812_INSTANCE_ID, WS2812_SET_PIXEL, WS2812_E_PARAM_PIXEL);
+    return;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
+
+  Ws2812_EncodePixel(&Ws2812_Frame[Ws2812_Back][(uint32)Pixel * WS2812_BYTES_PER_PIXEL], Red, Green, Blue);
+}
+
+/************************************************************************************
+* Service Name: Ws2812_Show
+* Service ID[hex]: 0x02
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK while the previous frame is transmitted
+* Description: Swaps the buffers and streams the prepared frame to SSI0. The
+*              uDMA alternates the two control structures over the chunks of
+*              the frame, SSI0_Handler re-arms the one that completed. The
+*              new back buffer starts as a copy of the frame being sent.
+************************************************************************************/
+Std_ReturnType Ws2812_Show(void)
+{
+  #if (WS2812_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(Ws2812_Status == WS2812_NOT_INITIALIZED)
+  {
+    Det_ReportError(WS2812_MODULE_ID, WS2812_INSTANCE_ID, WS2812_SHOW, WS2812_E_UNINIT);
+    return E_NOT_OK;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  #endif
+
+  if(Ws2812_Busy == TRUE)
+  {
+    return E_NOT_OK;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+
+  Ws2812_Back ^= 1U;
+  Ws2812_Completed = 0;
+  Ws2812_Busy = TRUE;
+
+  /* The new back buffer still holds the frame of two Shows ago, start it from the frame
+     being sent so Ws2812_SetPixel only has to update the pixels that change */
+  {
+    const uint8 * Sent = Ws2812_Frame[Ws2812_Back ^ 1U];
+    uint8 * Next = Ws2812_Frame[Ws2812_Back];
+
+    for (uint16 index = 0; index < (WS2812_NUMBER_OF_PIXELS * WS2812_BYTES_PER_PIXEL); index++)
+    {
+      Next[index] = Sent[index];
+    }
+  }
+
+  Udma_ConfigureChannel(WS2812_CHANNEL, UDMA_ENC_0);
+  Ws2812_ArmChunk(FALSE, 0);
+  Ws2812_Armed = 1;
+  if(WS2812_CHUNKS > 1U)
+  {
+    Ws2812_ArmChunk(TRUE, 1);
+    Ws2812_Armed = 2;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  Udma_EnableChannel(WS2812_CHANNEL);
+
+  return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Ws2812_IsBusy
+* Description: TRUE while a frame is transmitted
+************************************************************************************/
+boolean Ws2812_IsBusy(void)
+{
+  return Ws2812_Busy;
+}
+
+/************************************************************************************
+* Service Name: SSI0_Handler
+* Description: SSI0 ISR, re-arms the completed control structure with the next
+*              chunk of the frame and ends the frame after its last chunk.
+************************************************************************************/
+void SSI0_Handler(void)
+{
+  if(Udma_IsChannelDone(WS2812_CHANNEL) == TRUE)
+  {
+    /* Chunks alternate primary, alternate, primary ... */
+    boolean alternate = ((Ws2812_Completed & 1U) != 0U) ? TRUE : FALSE;
+
+    Udma_ClearChannelDone(WS2812_CHANNEL);
+    Ws2812_Completed++;
+
+    if(Ws2812_Armed < WS2812_CHUNKS)
+    {
+      Ws2812_ArmChunk(alternate, Ws2812_Armed);
+      Ws2812_Armed++;
+    }
+    else if(Ws2812_Completed == WS2812_CHUNKS)
+    {
+      /* The reset bytes still in the TX FIFO end the frame on the wire */
+      Ws2812_Busy = FALSE;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+}
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
@@ -0,0 +1,124 @@
+/**********************************************************************************
+ Module	     : Ws2812
+ File Name   : Ws2812.h
+ Author	     : Yasser Waleed
+ Description : Header file of the WS2812 addressable LED strip driver. Frames
+               are pre-encoded into SSI code bytes and streamed to SSI0 by the
+               uDMA, with a second frame buffer filled during transmission.
+***********************************************************************************/
+#ifndef WS2812_H
+#define WS2812_H
+/**********************************************************************************
+ INCLUDES
+***********************************************************************************/
+#include "Std_Types.h"
+#include "Ws2812_Cfg.h"
+/**********************************************************************************
+ VERSIONS CHECK
+***********************************************************************************/
+/* Module Version 1.0.0 */
+#define WS2812_SW_MAJOR_VERSION         (1U)
+#define WS2812_SW_MINOR_VERSION         (0U)
+#define WS2812_SW_PATCH_VERSION         (0U)
+
+/* AUTOSAR Version 4.0.3 */
+#define WS2812_AR_RELEASE_MAJOR_VERSION (4U)
+#define WS2812_AR_RELEASE_MINOR_VERSION (0U)
+#define WS2812_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Macros for Ws2812 Status */
+#define WS2812_INITIALIZED              (1U)
+#define WS2812_NOT_INITIALIZED          (0U)
+
+/* AUTOSAR Version checking between Ws2812_Cfg.h and Ws2812.h files */
+#if ((WS2812_CFG_AR_RELEASE_MAJOR_VERSION != WS2812_AR_RELEASE_MAJOR_VERSION)\
+ ||  (WS2812_CFG_AR_RELEASE_MINOR_VERSION != WS2812_AR_RELEASE_MINOR_VERSION)\
+ ||  (WS2812_CFG_AR_RELEASE_PATCH_VERSION != WS2812_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Ws2812_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Ws2812_Cfg.h and Ws2812.h files */
+#if ((WS2812_CFG_SW_MAJOR_VERSION != WS2812_SW_MAJOR_VERSION)\
+ ||  (WS2812_CFG_SW_MINOR_VERSION != WS2812_SW_MINOR_VERSION)\
+ ||  (WS2812_CFG_SW_PATCH_VERSION != WS2812_SW_PATCH_VERSION))
+  #error "The SW version of Ws2812_Cfg.h does not match the expected version"
+#endif
+/**********************************************************************************
+ ID MACROS
+***********************************************************************************/
+#define WS2812_VENDOR_ID    (1010U) 	/* ID for the vendor (company) in AUTOSAR, 1010 isn't an actual vendor ID */
+#define WS2812_MODULE_ID    (255U) 	/* Complex Driver Module Id */
+#define WS2812_INSTANCE_ID  (1U) 		/* Ws2812 Instance Id, Pbus is instance 0 */
+/******************************************************************************
+ *      API SERVICE ID MACROS                                                 *
+ ******************************************************************************/
+#define WS2812_INIT                 (uint8)0x00
+#define WS2812_SET_PIXEL            (uint8)0x01
+#define WS2812_SHOW                 (uint8)0x02
+/******************************************************************************
+ *      DET ERROR MACROS                                                      *
+ ******************************************************************************/
+#define WS2812_E_UNINIT                  (uint8)0x01 /* API service called without module initialization */
+#define WS2812_E_PARAM_PIXEL             (uint8)0x02 /* Pixel index beyond the strip */
+/**********************************************************************************
+ MACROS
+***********************************************************************************/
+#define WS2812_BITS_PER_CODE            (3U)            /* LED bit 0 is sent as 100, 1 as 110 */
+#define WS2812_BYTES_PER_PIXEL          (3U * WS2812_BITS_PER_CODE)     /* G, R and B bytes, 24 code bits each */
+#define WS2812_FRAME_BYTES              ((WS2812_NUMBER_OF_PIXELS * WS2812_BYTES_PER_PIXEL) + WS2812_RESET_BYTES)
+/**********************************************************************************
+ FUNCTION PROTOTYPES
+***********************************************************************************/
+/*******************************************************************************
+* Service Name: Ws2812_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Encodes a black frame in both buffers, muxes the data pin to
+*              SSI0Tx and sets SSI0 up as the uDMA driven bit stream master.
+*              Port_Init must have been called.
+********************************************************************************/
+void Ws2812_Init(void);
+
+/*******************************************************************************
+* Service Name: Ws2812_SetPixel
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Pixel - Index of the pixel on the strip
+*                  Red, Green, Blue - Color of the pixel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Encodes the pixel into the frame being prepared.
+********************************************************************************/
+void Ws2812_SetPixel(uint16 Pixel, uint8 Red, uint8 Green, uint8 Blue);
+
+/*******************************************************************************
+* Service Name: Ws2812_Show
+* Service ID[hex]: 0x02
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK while the previous frame is transmitted
+* Description: Starts the transmission of the prepared frame. The other buffer
+*              becomes the prepared frame, starting as a copy of the frame being
+*              sent, so only the pixels that change need Ws2812_SetPixel.
+********************************************************************************/
+Std_ReturnType Ws2812_Show(void);
+
+/* TRUE while a frame is transmitted */
+boolean Ws2812_IsBusy(void);
+
+/* SSI0 interrupt handler, raised by the uDMA completion of the SSI0 TX channel */
+void SSI0_Handler(void);
+/*******************************************************************************
+ END OF FILE
+********************************************************************************/
+#endif
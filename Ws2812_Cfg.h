@@ -0,0 +1,42 @@
+/**********************************************************************************
+ Module		: Ws2812
+ File Name	: Ws2812_Cfg.h
+ Author		: Yasser Waleed
+ Description    : Header file containing the addressable LED strip configurations:
+		  strip length, SSI bit timing, latch time and the data pin.
+***********************************************************************************/
+#ifndef WS2812_CFG_H
+#define WS2812_CFG_H
+/**********************************************************************************
+ VERSIONS CHECK
+***********************************************************************************/
+/* Module Version 1.0.0 */
+#define WS2812_CFG_SW_MAJOR_VERSION                    (1U)
+#define WS2812_CFG_SW_MINOR_VERSION                    (0U)
+#define WS2812_CFG_SW_PATCH_VERSION                    (0U)
+
+/* AUTOSAR Version 4.0.3 */
+#define WS2812_CFG_AR_RELEASE_MAJOR_VERSION            (4U)
+#define WS2812_CFG_AR_RELEASE_MINOR_VERSION            (0U)
+#define WS2812_CFG_AR_RELEASE_PATCH_VERSION            (3U)
+/**********************************************************************************
+ CONFIGURATIONS
+***********************************************************************************/
+#define WS2812_DEV_ERROR_DETECT         (STD_ON)        /* Enable/Disable Development Error Detection */
+
+#define WS2812_NUMBER_OF_PIXELS         (300U)          /* Pixels of the strip, two encoded frames are kept in RAM */
+
+/* SSI0 bit clock = 16MHz / (CPSDVSR * (1 + SCR)) = 2.667MHz, 375ns per code bit. With the gapless
+   SPH = 1 frames a 0 is 375ns high and 750ns low, a 1 is 750ns high and 375ns low, 1.125us per LED
+   bit and 27us per pixel (300 pixels: 8.1ms plus the reset time) */
+#define WS2812_SSI_CPSDVSR              (2U)
+#define WS2812_SSI_SCR                  (2U)
+
+#define WS2812_RESET_BYTES              (100U)          /* Low bytes closing every frame, 300us latch time */
+
+#define WS2812_INTERRUPT_PRIORITY       (2U)            /* NVIC priority of the SSI0 chunk re-arm ISR */
+
+#define WS2812_TX_PIN                   (5U)            /* Port Pin ID of PA5 (SSI0Tx) in Port_PBcfg.c */
+#define WS2812_TX_PIN_MODE              PORT_PIN_MODE_ALT2
+
+#endif /* WS2812_CFG_H */
@@ -23,6 +23,16 @@ extern void SVC_Handler( void );
 extern void DebugMon_Handler( void );
 extern void PendSV_Handler( void );
 extern void SysTick_Handler( void );
+extern void GPIOPortA_Handler( void );
+extern void GPIOPortB_Handler( void );
+extern void GPIOPortC_Handler( void );
+extern void GPIOPortD_Handler( void );
+extern void GPIOPortE_Handler( void );
+extern void GPIOPortF_Handler( void );
+extern void SSI0_Handler( void );
+extern void Timer0A_Handler( void );
+extern void Timer1A_Handler( void );
+extern void Timer2A_Handler( void );
 
 typedef void( *intfunc )( void );
 typedef union { intfunc __fun; void * __ptr; } intvec_elem;
@@ -56,7 +66,39 @@ const intvec_elem __vector_table[] =
   DebugMon_Handler,
   0,
   PendSV_Handler,
-  SysTick_Handler
+  SysTick_Handler,
+
+  GPIOPortA_Handler,                    // IRQ 0  GPIO Port A
+  GPIOPortB_Handler,                    // IRQ 1  GPIO Port B
+  GPIOPortC_Handler,                    // IRQ 2  GPIO Port C
+  GPIOPortD_Handler,                    // IRQ 3  GPIO Port D
+  GPIOPortE_Handler,                    // IRQ 4  GPIO Port E
+  0,                                    // IRQ 5  UART0
+  0,                                    // IRQ 6  UART1
+  SSI0_Handler,                         // IRQ 7  SSI0
+  0,                                    // IRQ 8  I2C0
+  0,                                    // IRQ 9  PWM0 Fault
+  0,                                    // IRQ 10 PWM0 Generator 0
+  0,                                    // IRQ 11 PWM0 Generator 1
+  0,                                    // IRQ 12 PWM0 Generator 2
+  0,                                    // IRQ 13 QEI0
+  0,                                    // IRQ 14 ADC0 Sequence 0
+  0,                                    // IRQ 15 ADC0 Sequence 1
+  0,                                    // IRQ 16 ADC0 Sequence 2
+  0,                                    // IRQ 17 ADC0 Sequence 3
+  0,                                    // IRQ 18 Watchdog 0/1
+  Timer0A_Handler,                      // IRQ 19 Timer 0A
+  0,                                    // IRQ 20 Timer 0B
+  Timer1A_Handler,                      // IRQ 21 Timer 1A
+  0,                                    // IRQ 22 Timer 1B
+  Timer2A_Handler,                      // IRQ 23 Timer 2A
+  0,                                    // IRQ 24 Timer 2B
+  0,                                    // IRQ 25 Analog Comparator 0
+  0,                                    // IRQ 26 Analog Comparator 1
+  0,                                    // IRQ 27 Reserved
+  0,                                    // IRQ 28 System Control
+  0,                                    // IRQ 29 Flash Memory Control
+  GPIOPortF_Handler                     // IRQ 30 GPIO Port F
 
 };
 
@@ -78,6 +120,26 @@ __weak void DebugMon_Handler( void ) { while (1) {} }
 __weak void PendSV_Handler( void ) { while (1) {} }
 #pragma call_graph_root = "interrupt"
 __weak void SysTick_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortA_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortB_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortC_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortD_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortE_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortF_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void SSI0_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer0A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer1A_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void Timer2A_Handler( void ) { while (1) {} }
 
 
 void __cmain( void );
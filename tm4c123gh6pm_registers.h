@@ -12,14 +12,27 @@ GPIO Registers base addresses
 #define GPIO_PORTD_BASE_ADDRESS           0x40007000
 #define GPIO_PORTE_BASE_ADDRESS           0x40024000
 #define GPIO_PORTF_BASE_ADDRESS           0x40025000
+
+/* Advanced High-Performance Bus aperture, enabled per port in GPIOHBCTL */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
 /*****************************************************************************
 GPIO Registers offset addresses
 *****************************************************************************/
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
+#define PORT_DRIVE_2MA_REG_OFFSET         0x500
+#define PORT_DRIVE_4MA_REG_OFFSET         0x504
+#define PORT_DRIVE_8MA_REG_OFFSET         0x508
+#define PORT_OPEN_DRAIN_REG_OFFSET        0x50C
 #define PORT_PULL_UP_REG_OFFSET           0x510
 #define PORT_PULL_DOWN_REG_OFFSET         0x514
+#define PORT_SLEW_RATE_REG_OFFSET         0x518
 #define PORT_DIGITAL_ENABLE_REG_OFFSET    0x51C
 #define PORT_LOCK_REG_OFFSET              0x520
 #define PORT_COMMIT_REG_OFFSET            0x524
@@ -159,6 +172,15 @@ GPIO registers (PORTF)
 #define GPIO_PORTF_ICR_REG        (*((volatile uint32 *)0x4002541C))
 
 #define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
+#define SYSCTL_GPIOHBCTL_REG      (*((volatile uint32 *)0x400FE06C))
+#define SYSCTL_RCGCGPIO_REG       (*((volatile uint32 *)0x400FE608))
+#define SYSCTL_PRGPIO_REG         (*((volatile uint32 *)0x400FEA08))
+#define SYSCTL_RCGCTIMER_REG      (*((volatile uint32 *)0x400FE604))
+#define SYSCTL_PRTIMER_REG        (*((volatile uint32 *)0x400FEA04))
+#define SYSCTL_RCGCDMA_REG        (*((volatile uint32 *)0x400FE60C))
+#define SYSCTL_PRDMA_REG          (*((volatile uint32 *)0x400FEA0C))
+#define SYSCTL_RCGCSSI_REG        (*((volatile uint32 *)0x400FE61C))
+#define SYSCTL_PRSSI_REG          (*((volatile uint32 *)0x400FEA1C))
 
 
 /*****************************************************************************
@@ -168,6 +190,13 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+/*****************************************************************************
+Data Watchpoint and Trace Registers (cycle counter)
+*****************************************************************************/
+#define CORE_DEMCR_REG            (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
 /*****************************************************************************
 PLL Registers
 *****************************************************************************/
@@ -175,6 +204,23 @@ PLL Registers
 #define SYSCTL_RCC_REG            (*((volatile uint32 *)0x400FE060))
 #define SYSCTL_RCC2_REG           (*((volatile uint32 *)0x400FE070))
 
+/*****************************************************************************
+General-Purpose Timer Registers base addresses (16/32-bit timers)
+*****************************************************************************/
+#define GPTM_TIMER0_BASE_ADDRESS          0x40030000
+#define GPTM_TIMER1_BASE_ADDRESS          0x40031000
+#define GPTM_TIMER2_BASE_ADDRESS          0x40032000
+
+/*****************************************************************************
+uDMA Registers base address
+*****************************************************************************/
+#define UDMA_BASE_ADDRESS                 0x400FF000
+
+/*****************************************************************************
+Synchronous Serial Interface Registers base addresses
+*****************************************************************************/
+#define SSI0_BASE_ADDRESS                 0x40008000
+
 /*****************************************************************************
 NVIC Registers
 *****************************************************************************/